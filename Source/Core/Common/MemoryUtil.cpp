@@ -16,6 +16,7 @@
 #else
 #include <stdio.h>
 #include <sys/mman.h>
+#include <unistd.h>
 #if defined(_M_ARM_64) && defined(__APPLE__)
 #include <pthread.h>
 #endif
@@ -250,6 +251,17 @@ bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute)
   return true;
 }
 
+size_t GetPageSize()
+{
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwPageSize;
+#else
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
 size_t MemPhysical()
 {
 #ifdef _WIN32
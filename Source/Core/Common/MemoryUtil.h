@@ -33,6 +33,8 @@ void FreeAlignedMemory(void* ptr);
 bool ReadProtectMemory(void* ptr, size_t size);
 bool WriteProtectMemory(void* ptr, size_t size, bool executable = false);
 bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute = false);
+// Returns the granularity of the protection functions above.
+size_t GetPageSize();
 size_t MemPhysical();
 
 }  // namespace Common
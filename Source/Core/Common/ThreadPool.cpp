@@ -0,0 +1,139 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "Common/Thread.h"
+
+namespace Common
+{
+void ThreadPool::Reset(std::string name, size_t thread_count)
+{
+  Shutdown();
+
+  std::lock_guard lk(m_mutex);
+  m_shutting_down = false;
+  m_threads.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i)
+    m_threads.emplace_back(&ThreadPool::ThreadLoop, this, name);
+}
+
+void ThreadPool::Push(FunctionType function)
+{
+  {
+    std::lock_guard lk(m_mutex);
+    m_items.emplace_back(std::move(function));
+  }
+  m_item_available.notify_one();
+}
+
+void ThreadPool::Cancel()
+{
+  std::lock_guard lk(m_mutex);
+  m_items.clear();
+  if (m_items_in_progress == 0)
+    m_idle.notify_all();
+}
+
+void ThreadPool::WaitForCompletion()
+{
+  std::unique_lock lk(m_mutex);
+  if (m_threads.empty())
+    return;
+
+  m_idle.wait(lk, [this] { return m_items.empty() && m_items_in_progress == 0; });
+}
+
+void ThreadPool::Shutdown()
+{
+  std::vector<std::thread> threads;
+  {
+    std::lock_guard lk(m_mutex);
+    m_shutting_down = true;
+    threads.swap(m_threads);
+  }
+  m_item_available.notify_all();
+
+  for (std::thread& thread : threads)
+    thread.join();
+}
+
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& function)
+{
+  if (count == 0)
+    return;
+
+  struct SharedState
+  {
+    std::atomic<size_t> next_index = 0;
+    std::atomic<size_t> done_count = 0;
+    size_t count;
+    const std::function<void(size_t)>* function;
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+
+  // Helpers may start running after this function has returned if the pool was busy,
+  // so everything they touch has to outlive this stack frame.
+  const auto state = std::make_shared<SharedState>();
+  state->count = count;
+  state->function = &function;
+
+  const auto run = [](SharedState& s) {
+    size_t finished = 0;
+    for (size_t i = s.next_index++; i < s.count; i = s.next_index++)
+    {
+      (*s.function)(i);
+      ++finished;
+    }
+
+    if (finished != 0 && s.done_count.fetch_add(finished) + finished == s.count)
+    {
+      std::lock_guard lk(s.mutex);
+      s.done.notify_all();
+    }
+  };
+
+  const size_t helper_count = std::min(count - 1, GetThreadCount());
+  for (size_t i = 0; i < helper_count; ++i)
+    Push([state, run] { run(*state); });
+
+  run(*state);
+
+  std::unique_lock lk(state->mutex);
+  state->done.wait(lk, [&] { return state->done_count.load() == count; });
+}
+
+size_t ThreadPool::GetDefaultThreadCount()
+{
+  return std::max(1u, std::thread::hardware_concurrency()) - 1;
+}
+
+void ThreadPool::ThreadLoop(const std::string& name)
+{
+  Common::SetCurrentThreadName(name.c_str());
+
+  std::unique_lock lk(m_mutex);
+  while (true)
+  {
+    m_item_available.wait(lk, [this] { return !m_items.empty() || m_shutting_down; });
+    if (m_items.empty())
+      return;
+
+    FunctionType function = std::move(m_items.front());
+    m_items.pop_front();
+    ++m_items_in_progress;
+
+    lk.unlock();
+    function();
+    lk.lock();
+
+    if (--m_items_in_progress == 0 && m_items.empty())
+      m_idle.notify_all();
+  }
+}
+}  // namespace Common
@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Common
+{
+// A fixed set of worker threads that run pushed functions in FIFO order.
+// Multiple threads may use the public interface.
+class ThreadPool final
+{
+public:
+  using FunctionType = std::function<void()>;
+
+  ThreadPool() = default;
+  ThreadPool(std::string name, size_t thread_count) { Reset(std::move(name), thread_count); }
+  ~ThreadPool() { Shutdown(); }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  // Shuts the current threads down (if any) and starts thread_count new ones.
+  // Items pushed before Reset are processed once the new threads are running.
+  void Reset(std::string name, size_t thread_count);
+
+  // Adds an item to the work queue.
+  void Push(FunctionType function);
+
+  // Empties the queue, skipping all work that hasn't started yet.
+  void Cancel();
+
+  // Blocks until all items in the queue have been processed.
+  // Does nothing if no threads are running.
+  void WaitForCompletion();
+
+  // Tells the worker threads to stop when the queue is empty and waits for them to exit.
+  void Shutdown();
+
+  size_t GetThreadCount() const { return m_threads.size(); }
+
+  // Calls function(i) for every i in [0, count) using the worker threads as well as the calling
+  // thread, and returns once all calls have finished. Work is only ever picked up by idle
+  // workers, so this is safe to call from within a pool item.
+  void ParallelFor(size_t count, const std::function<void(size_t)>& function);
+
+  // A thread count that leaves one hardware thread for the caller.
+  static size_t GetDefaultThreadCount();
+
+private:
+  void ThreadLoop(const std::string& name);
+
+  std::vector<std::thread> m_threads;
+  std::deque<FunctionType> m_items;
+  size_t m_items_in_progress = 0;
+  bool m_shutting_down = false;
+
+  std::mutex m_mutex;
+  std::condition_variable m_item_available;
+  std::condition_variable m_idle;
+};
+}  // namespace Common
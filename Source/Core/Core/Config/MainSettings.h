@@ -49,6 +49,11 @@ namespace HSP
 enum class HSPDeviceType : int;
 }
 
+namespace State
+{
+enum CompressionType : u16;
+}
+
 namespace Config
 {
 // Main.Core
@@ -59,6 +64,12 @@ extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
+extern const Info<bool> MAIN_JIT_BLOCK_PROFILE;
+extern const Info<bool> MAIN_JIT_TIERED_COMPILATION;
+extern const Info<u32> MAIN_JIT_TIER_UP_THRESHOLD;
+extern const Info<bool> MAIN_JIT_BACKGROUND_COMPILATION;
+extern const Info<bool> MAIN_JIT_SUPERBLOCKS;
+extern const Info<bool> MAIN_JIT_LINEAR_SCAN_REGISTER_ALLOCATION;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
 extern const Info<bool> MAIN_DSP_HLE;
@@ -69,6 +80,8 @@ extern const Info<bool> MAIN_RUSH_FRAME_PRESENTATION;
 extern const Info<bool> MAIN_SMOOTH_EARLY_PRESENTATION;
 extern const Info<bool> MAIN_CPU_THREAD;
 extern const Info<bool> MAIN_LOAD_GAME_INTO_MEMORY;
+// In MiB. Zero means that the whole game is loaded.
+extern const Info<u32> MAIN_LOAD_GAME_INTO_MEMORY_LIMIT;
 extern const Info<bool> MAIN_SYNC_ON_SKIP_IDLE;
 extern const Info<std::string> MAIN_DEFAULT_ISO;
 extern const Info<bool> MAIN_ENABLE_CHEATS;
@@ -123,6 +136,9 @@ extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
+extern const Info<bool> MAIN_DVD_READ_AHEAD;
+// In MiB
+extern const Info<u32> MAIN_DVD_READ_AHEAD_CACHE_SIZE;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FLOAT_EXCEPTIONS;
 extern const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS;
@@ -161,6 +177,16 @@ extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+// When enabled, states are saved as deltas against a shared base state, which is rewritten
+// whenever too much of the state has changed since it was taken.
+extern const Info<bool> MAIN_SAVESTATE_DELTA;
+// Delta is not a valid value here, see MAIN_SAVESTATE_DELTA.
+extern const Info<State::CompressionType> MAIN_SAVESTATE_COMPRESSION;
+extern const Info<bool> MAIN_REWIND_ENABLE;
+// In milliseconds of emulated time
+extern const Info<u32> MAIN_REWIND_INTERVAL;
+// In MiB
+extern const Info<u32> MAIN_REWIND_BUFFER_SIZE;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
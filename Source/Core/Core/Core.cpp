@@ -56,6 +56,7 @@
 #include "Core/HW/GCKeyboard.h"
 #include "Core/HW/GCPad.h"
 #include "Core/HW/HW.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/Wiimote.h"
@@ -339,6 +340,14 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   if (exception_handler)
     EMM::InstallExceptionHandler();
 
+  // Write tracking relies on the exception handler seeing the writes of every thread, including
+  // the GPU and DSP threads. IOS passes emulated memory straight to host file and socket APIs,
+  // which fail instead of faulting on write-protected pages, so it's GameCube only.
+  const bool write_tracking =
+      exception_handler && EMM::IsExceptionHandlerProcessWide() && !system.IsWii();
+  if (write_tracking)
+    system.GetMemory().SetWriteTrackingActive(true);
+
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher = std::make_unique<MemoryWatcher>();
 #endif
@@ -390,6 +399,9 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   s_memory_watcher.reset();
 #endif
 
+  if (write_tracking)
+    system.GetMemory().SetWriteTrackingActive(false);
+
   if (exception_handler)
     EMM::UninstallExceptionHandler();
 
@@ -225,6 +225,7 @@ public:
     m_parent->m_system.GetCPU().SetStepping(false);
 
     m_parent->m_CurrentFrame = m_parent->m_FrameRangeStart;
+    m_parent->m_LoopsPlayed = 0;
     m_parent->LoadMemory();
   }
 
@@ -272,7 +273,8 @@ CPU::State FifoPlayer::AdvanceFrame()
 {
   if (m_CurrentFrame > m_FrameRangeEnd)
   {
-    if (!m_Loop)
+    ++m_LoopsPlayed;
+    if (!m_Loop || (m_LoopLimit != 0 && m_LoopsPlayed >= m_LoopLimit))
       return CPU::State::PowerDown;
 
     // When looping, reload the contents of all the BP/CP/CF registers.
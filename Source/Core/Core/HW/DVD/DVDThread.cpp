@@ -56,6 +56,7 @@ void DVDThread::Stop()
   m_result_queue.Clear();
   m_result_map.clear();
 
+  m_read_ahead.SetDisc(nullptr);
   m_disc.reset();
 }
 
@@ -86,7 +87,7 @@ void DVDThread::DoState(PointerWrap& p)
     if (had_disc)
       PanicAlertFmtT("An inserted disc was expected but not found.");
     else
-      m_disc.reset();
+      SetDisc(nullptr);
   }
 
   // TODO: Savestates can be smaller if the buffers of results aren't saved,
@@ -103,6 +104,7 @@ void DVDThread::DoState(PointerWrap& p)
 void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
+  m_read_ahead.SetDisc(disc.get());
   m_disc = std::move(disc);
 }
 
@@ -298,7 +300,12 @@ void DVDThread::ProcessReadRequest(ReadRequest&& request)
   m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
   std::vector<u8> buffer(request.length);
-  if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+  const bool success =
+      m_read_ahead.IsActive() ?
+          m_read_ahead.Read(*m_disc, request.dvd_offset, request.length, buffer.data(),
+                            request.partition) :
+          m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition);
+  if (!success)
     buffer.resize(0);
 
   request.realtime_done_us = Common::Timer::NowUs();
@@ -15,6 +15,7 @@
 #include "Common/WorkQueueThread.h"
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/DVD/FileMonitor.h"
+#include "Core/HW/DVD/ReadAheadCache.h"
 
 #include "DiscIO/Volume.h"
 
@@ -132,6 +133,7 @@ private:
   std::map<u64, ReadResult> m_result_map;
 
   std::unique_ptr<DiscIO::Volume> m_disc;
+  ReadAheadCache m_read_ahead;
 
   FileMonitor::FileLogger m_file_logger;
 
@@ -0,0 +1,267 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DVD/ReadAheadCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+
+#include "Core/Config/MainSettings.h"
+
+#include "DiscIO/Blob.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeDisc.h"
+
+namespace DVD
+{
+constexpr u64 CHUNK_SIZE = 0x40000;
+
+// A read counts as sequential if it starts at most this far past where the previous one ended.
+constexpr u64 MAX_SEQUENTIAL_GAP = CHUNK_SIZE;
+
+// How many sequential reads in a row it takes before prefetching starts. The prefetch depth
+// then doubles with every further sequential read until it reaches the maximum.
+constexpr u32 SEQUENTIAL_READS_BEFORE_PREFETCH = 2;
+constexpr u32 MAX_PREFETCH_CHUNKS = 16;
+
+constexpr size_t THREAD_COUNT = 2;
+
+// Statistics are logged every time this many reads have been performed.
+constexpr u64 STATISTICS_INTERVAL = 0x1000;
+
+ReadAheadCache::ReadAheadCache() = default;
+
+ReadAheadCache::~ReadAheadCache()
+{
+  Clear();
+  m_pool.Shutdown();
+}
+
+void ReadAheadCache::SetDisc(const DiscIO::Volume* disc)
+{
+  if (IsActive() && m_read_count != 0)
+    LogStatistics();
+
+  Clear();
+
+  if (!disc || !Config::Get(Config::MAIN_DVD_READ_AHEAD))
+    return;
+
+  // Formats that can read anywhere cheaply gain nothing from prefetching.
+  const DiscIO::BlobReader& blob_reader = disc->GetBlobReader();
+  if (blob_reader.HasFastRandomAccessInBlock())
+    return;
+
+  // Prefetching on top of a reader that prefetches by itself would only decompress and buffer the
+  // same data twice, on twice as many threads.
+  if (blob_reader.PrefetchesSequentialReads())
+    return;
+
+  std::unique_ptr<DiscIO::BlobReader> reader = blob_reader.CopyReader();
+  if (!reader)
+    return;
+
+  const u64 cache_size = u64(Config::Get(Config::MAIN_DVD_READ_AHEAD_CACHE_SIZE)) * 1024 * 1024;
+
+  std::lock_guard lk(m_mutex);
+  m_reader = std::move(reader);
+  m_max_chunk_count = std::max<size_t>(cache_size / CHUNK_SIZE, 1);
+
+  if (m_pool.GetThreadCount() == 0)
+    m_pool.Reset("DVD Read-Ahead", THREAD_COUNT);
+
+  INFO_LOG_FMT(DVDINTERFACE, "Read-ahead enabled with a cache of {} chunks of {} KiB",
+               m_max_chunk_count, CHUNK_SIZE / 1024);
+}
+
+bool ReadAheadCache::Read(const DiscIO::Volume& disc, u64 offset, u64 length, u8* buffer,
+                          const DiscIO::Partition& partition)
+{
+  Stream& stream = m_streams[partition.offset];
+  const bool sequential =
+      offset >= stream.next_offset && offset - stream.next_offset <= MAX_SEQUENTIAL_GAP;
+  stream.sequential_reads = sequential ? stream.sequential_reads + 1 : 0;
+  stream.next_offset = offset + length;
+
+  bool success = ReadFromCache(offset, length, buffer, partition);
+  if (!success)
+    success = disc.Read(offset, length, buffer, partition);
+
+  if (stream.sequential_reads >= SEQUENTIAL_READS_BEFORE_PREFETCH)
+  {
+    const u32 doublings =
+        std::min<u32>(stream.sequential_reads - SEQUENTIAL_READS_BEFORE_PREFETCH, 31);
+    const u32 depth = std::min<u32>(MAX_PREFETCH_CHUNKS, 1u << doublings);
+    Prefetch(partition, stream.next_offset / CHUNK_SIZE, depth);
+  }
+
+  if (++m_read_count % STATISTICS_INTERVAL == 0)
+    LogStatistics();
+
+  return success;
+}
+
+bool ReadAheadCache::ReadFromCache(u64 offset, u64 length, u8* buffer,
+                                   const DiscIO::Partition& partition)
+{
+  if (length == 0)
+    return false;
+
+  const u64 first_chunk = offset / CHUNK_SIZE;
+  const u64 last_chunk = (offset + length - 1) / CHUNK_SIZE;
+
+  std::unique_lock lk(m_mutex);
+
+  for (u64 i = first_chunk; i <= last_chunk; ++i)
+  {
+    const auto it = m_chunks.find({partition.offset, i});
+    if (it == m_chunks.end())
+    {
+      ++m_misses;
+      return false;
+    }
+
+    // Chunks are only removed by the thread calling Read, so the iterator stays valid.
+    Chunk& chunk = it->second;
+    m_chunk_ready.wait(lk, [&chunk] { return chunk.ready; });
+    if (chunk.failed)
+    {
+      ++m_misses;
+      return false;
+    }
+
+    const u64 chunk_start = i * CHUNK_SIZE;
+    const u64 copy_start = std::max(offset, chunk_start);
+    const u64 copy_end = std::min(offset + length, chunk_start + CHUNK_SIZE);
+    std::memcpy(buffer + (copy_start - offset), chunk.data.data() + (copy_start - chunk_start),
+                copy_end - copy_start);
+
+    chunk.last_used = ++m_use_counter;
+    chunk.used = true;
+  }
+
+  ++m_hits;
+  return true;
+}
+
+void ReadAheadCache::Prefetch(const DiscIO::Partition& partition, u64 first_chunk, u32 chunk_count)
+{
+  std::lock_guard lk(m_mutex);
+
+  for (u64 i = first_chunk; i < first_chunk + chunk_count; ++i)
+  {
+    const ChunkKey key{partition.offset, i};
+    if (m_chunks.contains(key))
+      continue;
+
+    if (!MakeRoom())
+      break;
+
+    Chunk& chunk = m_chunks[key];
+    chunk.last_used = ++m_use_counter;
+
+    m_pool.Push([this, key, partition] { PrefetchChunk(key, partition); });
+  }
+}
+
+bool ReadAheadCache::MakeRoom()
+{
+  if (m_chunks.size() < m_max_chunk_count)
+    return true;
+
+  // Prefer evicting chunks that have already been read over ones that are yet to be needed.
+  auto victim = m_chunks.end();
+  for (auto it = m_chunks.begin(); it != m_chunks.end(); ++it)
+  {
+    const Chunk& chunk = it->second;
+    if (!chunk.ready)
+      continue;
+
+    if (victim == m_chunks.end() || std::tie(chunk.used, victim->second.last_used) >
+                                        std::tie(victim->second.used, chunk.last_used))
+    {
+      victim = it;
+    }
+  }
+
+  if (victim == m_chunks.end())
+    return false;
+
+  m_chunks.erase(victim);
+  return true;
+}
+
+void ReadAheadCache::PrefetchChunk(ChunkKey key, DiscIO::Partition partition)
+{
+  std::unique_ptr<DiscIO::Volume> volume;
+  std::unique_ptr<DiscIO::BlobReader> reader;
+  {
+    std::lock_guard lk(m_mutex);
+    if (!m_idle_volumes.empty())
+    {
+      volume = std::move(m_idle_volumes.back());
+      m_idle_volumes.pop_back();
+    }
+    else if (m_reader)
+    {
+      reader = m_reader->CopyReader();
+    }
+  }
+
+  if (reader)
+    volume = DiscIO::CreateDisc(std::move(reader));
+
+  std::vector<u8> data(CHUNK_SIZE);
+  const bool success =
+      volume && volume->Read(key.index * CHUNK_SIZE, CHUNK_SIZE, data.data(), partition);
+
+  {
+    std::lock_guard lk(m_mutex);
+
+    const auto it = m_chunks.find(key);
+    if (it != m_chunks.end())
+    {
+      it->second.data = std::move(data);
+      it->second.ready = true;
+      it->second.failed = !success;
+      if (success)
+        m_prefetched_bytes += CHUNK_SIZE;
+    }
+
+    if (volume)
+      m_idle_volumes.push_back(std::move(volume));
+  }
+
+  m_chunk_ready.notify_all();
+}
+
+void ReadAheadCache::LogStatistics() const
+{
+  std::lock_guard lk(m_mutex);
+  INFO_LOG_FMT(DVDINTERFACE, "Read-ahead: {} hits, {} misses, {} MiB prefetched", m_hits,
+               m_misses, m_prefetched_bytes / (1024 * 1024));
+}
+
+void ReadAheadCache::Clear()
+{
+  m_pool.Cancel();
+  m_pool.WaitForCompletion();
+
+  m_streams.clear();
+  m_read_count = 0;
+
+  std::lock_guard lk(m_mutex);
+  m_chunks.clear();
+  m_use_counter = 0;
+  m_reader.reset();
+  m_idle_volumes.clear();
+  m_hits = 0;
+  m_misses = 0;
+  m_prefetched_bytes = 0;
+}
+}  // namespace DVD
@@ -0,0 +1,105 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <compare>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
+
+namespace DiscIO
+{
+class BlobReader;
+struct Partition;
+class Volume;
+}  // namespace DiscIO
+
+namespace DVD
+{
+// Detects sequential reads within each partition and prefetches the data that follows them on
+// background threads, so that reads from formats with slow random access (such as WIA and RVZ)
+// don't stall the DVD thread whenever they cross into a new compressed chunk.
+//
+// Read may only be called from one thread at a time. SetDisc must not be called concurrently
+// with Read.
+class ReadAheadCache final
+{
+public:
+  ReadAheadCache();
+  ~ReadAheadCache();
+
+  ReadAheadCache(const ReadAheadCache&) = delete;
+  ReadAheadCache& operator=(const ReadAheadCache&) = delete;
+  ReadAheadCache(ReadAheadCache&&) = delete;
+  ReadAheadCache& operator=(ReadAheadCache&&) = delete;
+
+  // Drops all cached data. If disc isn't nullptr and read-ahead would be useful for it,
+  // the cache gets activated for that disc. The volume itself isn't retained.
+  void SetDisc(const DiscIO::Volume* disc);
+  bool IsActive() const { return m_reader != nullptr; }
+
+  // Behaves like disc.Read, but serves the data from the cache when possible.
+  // disc must be the volume that was last passed to SetDisc.
+  bool Read(const DiscIO::Volume& disc, u64 offset, u64 length, u8* buffer,
+            const DiscIO::Partition& partition);
+
+private:
+  struct ChunkKey
+  {
+    u64 partition_offset;
+    u64 index;
+
+    auto operator<=>(const ChunkKey&) const = default;
+  };
+
+  struct Chunk
+  {
+    std::vector<u8> data;
+    u64 last_used = 0;
+    bool used = false;
+    bool ready = false;
+    bool failed = false;
+  };
+
+  struct Stream
+  {
+    u64 next_offset = 0;
+    u32 sequential_reads = 0;
+  };
+
+  bool ReadFromCache(u64 offset, u64 length, u8* buffer, const DiscIO::Partition& partition);
+  void Prefetch(const DiscIO::Partition& partition, u64 first_chunk, u32 chunk_count);
+  bool MakeRoom();
+  void PrefetchChunk(ChunkKey key, DiscIO::Partition partition);
+  void LogStatistics() const;
+  void Clear();
+
+  Common::ThreadPool m_pool;
+
+  // Only accessed by the thread calling Read.
+  std::map<u64, Stream> m_streams;
+  u64 m_read_count = 0;
+
+  // Protects everything below.
+  mutable std::mutex m_mutex;
+  std::condition_variable m_chunk_ready;
+
+  std::map<ChunkKey, Chunk> m_chunks;
+  size_t m_max_chunk_count = 0;
+  u64 m_use_counter = 0;
+
+  // Volumes aren't thread-safe, so every worker reads through a volume of its own.
+  std::unique_ptr<DiscIO::BlobReader> m_reader;
+  std::vector<std::unique_ptr<DiscIO::Volume>> m_idle_volumes;
+
+  u64 m_hits = 0;
+  u64 m_misses = 0;
+  u64 m_prefetched_bytes = 0;
+};
+}  // namespace DVD
@@ -24,6 +24,7 @@
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
 #include "Core/IOS/IOS.h"
+#include "Core/Rewind.h"
 #include "Core/State.h"
 #include "Core/System.h"
 
@@ -35,6 +36,7 @@ void Init(Core::System& system, const Sram* override_sram)
   system.GetSystemTimers().PreInit();
 
   State::Init(system);
+  Rewind::Init(system);
 
   // Init the whole Hardware
   system.GetAudioInterface().Init();
@@ -77,6 +79,7 @@ void Shutdown(Core::System& system)
   system.GetSerialInterface().Shutdown();
   system.GetAudioInterface().Shutdown();
 
+  Rewind::Shutdown();
   State::Shutdown();
   system.GetCoreTiming().Shutdown();
 }
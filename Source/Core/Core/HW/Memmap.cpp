@@ -12,6 +12,7 @@
 #include <array>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <span>
 #include <tuple>
 
@@ -19,6 +20,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
@@ -41,6 +43,26 @@
 
 namespace Memory
 {
+namespace
+{
+class SpinLockGuard
+{
+public:
+  explicit SpinLockGuard(std::atomic_flag& flag) : m_flag(flag)
+  {
+    while (m_flag.test_and_set(std::memory_order_acquire))
+    {
+    }
+  }
+  SpinLockGuard(const SpinLockGuard&) = delete;
+  SpinLockGuard& operator=(const SpinLockGuard&) = delete;
+  ~SpinLockGuard() { m_flag.clear(std::memory_order_release); }
+
+private:
+  std::atomic_flag& m_flag;
+};
+}  // namespace
+
 MemoryManager::MemoryManager(Core::System& system) : m_system(system)
 {
 }
@@ -152,6 +174,7 @@ void MemoryManager::Init()
   m_logical_page_mappings_base = reinterpret_cast<u8*>(m_logical_page_mappings.data());
 
   InitMMIO(wii);
+  InitWriteTracking();
 
   Clear();
 
@@ -166,6 +189,10 @@ bool MemoryManager::IsAddressInFastmemArea(const u8* address) const
 
 bool MemoryManager::InitFastmemArena()
 {
+  // The new views don't inherit the protection of tracked pages.
+  SpinLockGuard write_tracking_guard(m_write_tracking_lock);
+  ResetWriteTracking();
+
   // Here we set up memory mappings for fastmem. The basic idea of fastmem is that we reserve 4 GiB
   // of virtual memory and lay out the addresses within that 4 GiB range just like the memory map of
   // the emulated system. This lets the JIT emulate PPC load/store instructions by translating a PPC
@@ -235,6 +262,11 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // The new views don't inherit the protection of tracked pages. BAT changes are rare enough that
+  // simply counting every tracked page as written is fine.
+  SpinLockGuard write_tracking_guard(m_write_tracking_lock);
+  ResetWriteTracking();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -294,7 +326,7 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, intersection_start});
           }
 
           m_logical_page_mappings[i] =
@@ -369,6 +401,9 @@ void MemoryManager::Shutdown()
   }
   m_arena.ReleaseSHMSegment();
   m_mmio_mapping.reset();
+  m_write_tracking_pages.reset();
+  m_write_tracking_page_count = 0;
+  m_write_tracking_mem1_page_count = 0;
   INFO_LOG_FMT(MEMMAP, "Memory system shut down.");
 }
 
@@ -377,6 +412,9 @@ void MemoryManager::ShutdownFastmemArena()
   if (!m_is_fastmem_arena_initialized)
     return;
 
+  SpinLockGuard write_tracking_guard(m_write_tracking_lock);
+  ResetWriteTracking();
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -402,6 +440,215 @@ void MemoryManager::ShutdownFastmemArena()
   m_is_fastmem_arena_initialized = false;
 }
 
+void MemoryManager::InitWriteTracking()
+{
+  m_write_tracking_page_size = Common::GetPageSize();
+  m_write_tracking_mem1_page_count = GetRamSize() / m_write_tracking_page_size;
+  m_write_tracking_page_count = m_write_tracking_mem1_page_count;
+  if (m_exram)
+    m_write_tracking_page_count += GetExRamSize() / m_write_tracking_page_size;
+  m_write_tracking_pages = std::make_unique<WriteTrackingPage[]>(m_write_tracking_page_count);
+  m_write_tracking_counter = 0;
+}
+
+std::optional<size_t> MemoryManager::GetWriteTrackingPageIndex(u32 address) const
+{
+  if (address < GetRamSize())
+    return address / m_write_tracking_page_size;
+
+  if (m_exram && (address >> 28) == 0x1 && (address & 0x0fffffff) < GetExRamSize())
+    return m_write_tracking_mem1_page_count + (address & 0x0fffffff) / m_write_tracking_page_size;
+
+  return std::nullopt;
+}
+
+std::optional<u32> MemoryManager::GetPhysicalAddressForHostPointer(const u8* pointer) const
+{
+  if (m_ram && pointer >= m_ram && pointer < m_ram + GetRamSize())
+    return static_cast<u32>(pointer - m_ram);
+
+  if (m_exram && pointer >= m_exram && pointer < m_exram + GetExRamSize())
+    return 0x10000000 | static_cast<u32>(pointer - m_exram);
+
+  if (!m_is_fastmem_arena_initialized)
+    return std::nullopt;
+
+  if (pointer >= m_physical_base && pointer < m_physical_base + 0x1'0000'0000)
+    return static_cast<u32>(pointer - m_physical_base);
+
+  for (const LogicalMemoryView& view : m_logical_mapped_entries)
+  {
+    const u8* view_pointer = static_cast<const u8*>(view.mapped_pointer);
+    if (pointer >= view_pointer && pointer < view_pointer + view.mapped_size)
+      return view.physical_address + static_cast<u32>(pointer - view_pointer);
+  }
+
+  return std::nullopt;
+}
+
+void MemoryManager::SetWriteTrackingPagesProtected(size_t first_index, size_t count,
+                                                   bool is_protected)
+{
+  // MEM1 and MEM2 aren't next to each other, so a range covering both is changed in two parts.
+  const size_t mem1_count = m_write_tracking_mem1_page_count;
+  if (first_index < mem1_count && first_index + count > mem1_count)
+  {
+    SetWriteTrackingPagesProtected(first_index, mem1_count - first_index, is_protected);
+    SetWriteTrackingPagesProtected(mem1_count, first_index + count - mem1_count, is_protected);
+    return;
+  }
+
+  const bool is_mem1 = first_index < mem1_count;
+  const size_t first_in_region = is_mem1 ? first_index : first_index - mem1_count;
+  const u32 offset = static_cast<u32>(first_in_region * m_write_tracking_page_size);
+  const u32 size = static_cast<u32>(count * m_write_tracking_page_size);
+  const u32 physical_address = is_mem1 ? offset : 0x10000000 | offset;
+
+  const auto set_protected = [is_protected](u8* pointer, size_t length) {
+    if (is_protected)
+      Common::WriteProtectMemory(pointer, length);
+    else
+      Common::UnWriteProtectMemory(pointer, length);
+  };
+
+  set_protected((is_mem1 ? m_ram : m_exram) + offset, size);
+
+  if (!m_is_fastmem_arena_initialized)
+    return;
+
+  set_protected(m_physical_base + physical_address, size);
+  for (const LogicalMemoryView& view : m_logical_mapped_entries)
+  {
+    // Only the part of the range that the view maps
+    const u64 start = std::max<u64>(physical_address, view.physical_address);
+    const u64 end =
+        std::min<u64>(u64(physical_address) + size, u64(view.physical_address) + view.mapped_size);
+    if (start < end)
+    {
+      u8* const view_pointer = static_cast<u8*>(view.mapped_pointer);
+      set_protected(view_pointer + (start - view.physical_address), end - start);
+    }
+  }
+}
+
+void MemoryManager::ResetWriteTracking()
+{
+  // Pages that aren't protected have already been counted as written since anyone tracked them.
+  const u64 stamp = ++m_write_tracking_counter;
+  size_t i = 0;
+  while (i < m_write_tracking_page_count)
+  {
+    if (!m_write_tracking_pages[i].is_protected)
+    {
+      ++i;
+      continue;
+    }
+
+    // Unprotect each run of protected pages at once.
+    const size_t first = i;
+    for (; i < m_write_tracking_page_count && m_write_tracking_pages[i].is_protected; ++i)
+    {
+      m_write_tracking_pages[i].is_protected = false;
+      m_write_tracking_pages[i].last_write.store(stamp, std::memory_order_release);
+    }
+    SetWriteTrackingPagesProtected(first, i - first, false);
+  }
+}
+
+void MemoryManager::SetWriteTrackingActive(bool active)
+{
+#if defined(__APPLE__) && defined(_M_ARM_64)
+  // Common::WriteProtectMemory leaves the protection of memory alone on this platform.
+  active = false;
+#endif
+
+  SpinLockGuard guard(m_write_tracking_lock);
+  if (!active)
+    ResetWriteTracking();
+  m_write_tracking_active.store(active, std::memory_order_relaxed);
+}
+
+u64 MemoryManager::TrackWrites(u32 address, u32 size)
+{
+  if (size == 0 || !IsWriteTrackingActive())
+    return 0;
+
+  // Same masking as GetSpanForAddress
+  address &= 0x3FFFFFFF;
+  const std::optional<size_t> first_page = GetWriteTrackingPageIndex(address);
+  const std::optional<size_t> last_page = GetWriteTrackingPageIndex(address + (size - 1));
+  if (!first_page || !last_page || *last_page < *first_page)
+    return 0;
+
+  SpinLockGuard guard(m_write_tracking_lock);
+  if (!IsWriteTrackingActive())
+    return 0;
+
+  const u64 stamp = ++m_write_tracking_counter;
+  size_t i = *first_page;
+  while (i <= *last_page)
+  {
+    if (m_write_tracking_pages[i].is_protected)
+    {
+      ++i;
+      continue;
+    }
+
+    // Protect each run of unprotected pages at once.
+    const size_t first = i;
+    for (; i <= *last_page && !m_write_tracking_pages[i].is_protected; ++i)
+      m_write_tracking_pages[i].is_protected = true;
+    SetWriteTrackingPagesProtected(first, i - first, true);
+  }
+  return stamp;
+}
+
+bool MemoryManager::WasWrittenSince(u32 address, u32 size, u64 stamp) const
+{
+  if (stamp == 0)
+    return true;
+
+  address &= 0x3FFFFFFF;
+  const std::optional<size_t> first_page = GetWriteTrackingPageIndex(address);
+  const std::optional<size_t> last_page = GetWriteTrackingPageIndex(address + (size - 1));
+  if (!first_page || !last_page || *last_page < *first_page)
+    return true;
+
+  for (size_t i = *first_page; i <= *last_page; ++i)
+  {
+    if (m_write_tracking_pages[i].last_write.load(std::memory_order_acquire) > stamp)
+      return true;
+  }
+  return false;
+}
+
+bool MemoryManager::HandleWriteTrackingFault(uintptr_t fault_address)
+{
+  if (!m_write_tracking_pages)
+    return false;
+
+  SpinLockGuard guard(m_write_tracking_lock);
+
+  const std::optional<u32> physical_address =
+      GetPhysicalAddressForHostPointer(reinterpret_cast<const u8*>(fault_address));
+  if (!physical_address)
+    return false;
+  const std::optional<size_t> index = GetWriteTrackingPageIndex(*physical_address);
+  if (!index)
+    return false;
+
+  // If the page isn't protected anymore, another thread got here first and the access can simply
+  // be retried. Pages of RAM are never protected for any other reason.
+  WriteTrackingPage& page = m_write_tracking_pages[*index];
+  if (page.is_protected)
+  {
+    page.last_write.store(++m_write_tracking_counter, std::memory_order_release);
+    SetWriteTrackingPagesProtected(*index, 1, false);
+    page.is_protected = false;
+  }
+  return true;
+}
+
 void MemoryManager::Clear()
 {
   if (m_ram)
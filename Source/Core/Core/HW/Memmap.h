@@ -4,7 +4,10 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -54,6 +57,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 physical_address;
 };
 
 class MemoryManager
@@ -101,6 +105,29 @@ public:
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // Write tracking lets emulated hardware find out whether a range of RAM has changed without
+  // looking at its contents. Tracked pages are write-protected in every view of them, and the first
+  // write to one of them is caught by the exception handler, which records it and makes the page
+  // writable again. Anything that writes to RAM from inside a system call (instead of faulting)
+  // isn't seen, and neither are faults on threads the exception handler doesn't cover, so tracking
+  // has to be activated by whoever installs the handler.
+  void SetWriteTrackingActive(bool active);
+  bool IsWriteTrackingActive() const
+  {
+    return m_write_tracking_active.load(std::memory_order_relaxed);
+  }
+
+  // Starts tracking writes to the given range of MEM1 or MEM2. Returns a stamp to pass to
+  // WasWrittenSince, or 0 if the range can't be tracked. Writes made after this returns are never
+  // missed, so callers should look at the contents of the range afterwards, not before.
+  u64 TrackWrites(u32 address, u32 size);
+  // Returns true if the range may have been written to since TrackWrites returned the stamp.
+  bool WasWrittenSince(u32 address, u32 size, u64 stamp) const;
+
+  // Called by the exception handler. Returns true if the fault was caused by write tracking and the
+  // access can be retried.
+  bool HandleWriteTrackingFault(uintptr_t fault_address);
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -253,8 +280,33 @@ private:
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
+  struct WriteTrackingPage
+  {
+    // Value of m_write_tracking_counter when the page was first written to after being protected
+    std::atomic<u64> last_write = 0;
+    bool is_protected = false;
+  };
+
+  // One entry per host page of MEM1, followed by one per host page of MEM2.
+  std::unique_ptr<WriteTrackingPage[]> m_write_tracking_pages;
+  size_t m_write_tracking_page_count = 0;
+  size_t m_write_tracking_mem1_page_count = 0;
+  size_t m_write_tracking_page_size = 0;
+  u64 m_write_tracking_counter = 0;
+  std::atomic<bool> m_write_tracking_active = false;
+  // A spin lock rather than a mutex, as it's taken by the exception handler. Nothing writes to RAM
+  // while holding it.
+  std::atomic_flag m_write_tracking_lock;
+
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+
+  void InitWriteTracking();
+  std::optional<size_t> GetWriteTrackingPageIndex(u32 address) const;
+  std::optional<u32> GetPhysicalAddressForHostPointer(const u8* pointer) const;
+  void SetWriteTrackingPagesProtected(size_t first_index, size_t count, bool is_protected);
+  // Makes every tracked page writable and counts it as written. The lock must be held.
+  void ResetWriteTracking();
 };
 }  // namespace Memory
@@ -8,6 +8,7 @@
 #include "Common/CommonFuncs.h"
 #include "Common/MsgHandler.h"
 
+#include "Core/HW/Memmap.h"
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/System.h"
@@ -62,7 +63,9 @@ static LONG NTAPI Handler(PEXCEPTION_POINTERS pPtrs)
     uintptr_t fault_address = (uintptr_t)pPtrs->ExceptionRecord->ExceptionInformation[1];
     SContext* ctx = pPtrs->ContextRecord;
 
-    if (Core::System::GetInstance().GetJitInterface().HandleFault(fault_address, ctx))
+    auto& system = Core::System::GetInstance();
+    if (system.GetMemory().HandleWriteTrackingFault(fault_address) ||
+        system.GetJitInterface().HandleFault(fault_address, ctx))
     {
       return EXCEPTION_CONTINUE_EXECUTION;
     }
@@ -120,6 +123,11 @@ bool IsExceptionHandlerSupported()
   return true;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return true;
+}
+
 #elif defined(__APPLE__) && !defined(USE_SIGACTION_ON_APPLE)
 
 static void CheckKR(const char* name, kern_return_t kr)
@@ -192,8 +200,9 @@ static void ExceptionThread(mach_port_t port)
 
     thread_state64_t* state = (thread_state64_t*)msg_in.old_state;
 
-    bool ok =
-        Core::System::GetInstance().GetJitInterface().HandleFault((uintptr_t)msg_in.code[1], state);
+    auto& system = Core::System::GetInstance();
+    bool ok = system.GetMemory().HandleWriteTrackingFault((uintptr_t)msg_in.code[1]) ||
+              system.GetJitInterface().HandleFault((uintptr_t)msg_in.code[1], state);
 
     // Set up the reply.
     msg_out.Head.msgh_bits = MACH_MSGH_BITS(MACH_MSGH_BITS_REMOTE(msg_in.Head.msgh_bits), 0);
@@ -256,6 +265,12 @@ bool IsExceptionHandlerSupported()
   return true;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  // The exception port is only set for the thread that installs the handler.
+  return false;
+}
+
 #elif defined(_POSIX_VERSION) && !defined(_M_GENERIC)
 
 static struct sigaction old_sa_segv;
@@ -292,8 +307,12 @@ static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context)
 #else
   SContext* const ctx = &context->uc_mcontext;
 #endif
-  if (Core::System::GetInstance().GetJitInterface().HandleFault(bad_address, ctx))
+  auto& system = Core::System::GetInstance();
+  if (system.GetMemory().HandleWriteTrackingFault(bad_address) ||
+      system.GetJitInterface().HandleFault(bad_address, ctx))
+  {
     return;
+  }
 
   // If JIT didn't handle the signal, restore the original handler and invoke it.
   const auto& old_sa =
@@ -348,6 +367,11 @@ bool IsExceptionHandlerSupported()
   return true;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return true;
+}
+
 #else  // _M_GENERIC or unsupported platform
 
 void InstallExceptionHandler()
@@ -363,6 +387,11 @@ bool IsExceptionHandlerSupported()
   return false;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return false;
+}
+
 #endif
 
 }  // namespace EMM
@@ -8,4 +8,6 @@ namespace EMM
 void InstallExceptionHandler();
 void UninstallExceptionHandler();
 bool IsExceptionHandlerSupported();
+// Whether the installed handler also sees faults on threads other than the one that installed it.
+bool IsExceptionHandlerProcessWide();
 }  // namespace EMM
@@ -52,16 +52,8 @@ void CachedInterpreter::Shutdown()
   m_block_cache.Shutdown();
 }
 
-void CachedInterpreter::ExecuteOneBlock()
+void CachedInterpreter::ExecuteBlock(PowerPC::PowerPCState& ppc_state, const u8* normal_entry)
 {
-  const u8* normal_entry = m_block_cache.Dispatch();
-  if (!normal_entry)
-  {
-    Jit(m_ppc_state.pc);
-    return;
-  }
-
-  auto& ppc_state = m_ppc_state;
   while (true)
   {
     const auto callback = *reinterpret_cast<const AnyCallback*>(normal_entry);
@@ -87,6 +79,18 @@ void CachedInterpreter::ExecuteOneBlock()
   }
 }
 
+void CachedInterpreter::ExecuteOneBlock()
+{
+  const u8* normal_entry = m_block_cache.Dispatch();
+  if (!normal_entry)
+  {
+    Jit(m_ppc_state.pc);
+    return;
+  }
+
+  ExecuteBlock(m_ppc_state, normal_entry);
+}
+
 void CachedInterpreter::Run()
 {
   auto& core_timing = m_system.GetCoreTiming();
@@ -220,34 +224,38 @@ s32 CachedInterpreter::CheckIdle(PowerPC::PowerPCState& ppc_state,
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
-bool CachedInterpreter::HandleFunctionHooking(u32 address)
+bool CachedInterpreter::HandleFunctionHooking(JitBase& jit, CachedInterpreterEmitter& emitter,
+                                              u32 address)
 {
   // CachedInterpreter inherits from JitBase and is considered a JIT by relevant code.
   // (see JitInterface and how m_mode is set within PowerPC.cpp)
-  const auto result = HLE::TryReplaceFunction(m_ppc_symbol_db, address, PowerPC::CoreMode::JIT);
+  const auto result = HLE::TryReplaceFunction(jit.m_ppc_symbol_db, address, PowerPC::CoreMode::JIT);
   if (!result)
     return false;
 
-  Write(HLEFunction, {m_system, address, result.hook_index});
+  emitter.Write(HLEFunction, {jit.m_system, address, result.hook_index});
 
   if (result.type != HLE::HookType::Replace)
     return false;
 
-  js.downcountAmount += js.st.numCycles;
-  WriteEndBlock();
+  jit.js.downcountAmount += jit.js.st.numCycles;
+  WriteEndBlock(jit, emitter);
   return true;
 }
 
-void CachedInterpreter::WriteEndBlock()
+void CachedInterpreter::WriteEndBlock(JitBase& jit, CachedInterpreterEmitter& emitter)
 {
-  if (IsProfilingEnabled())
+  const auto& js = jit.js;
+  if (jit.IsProfilingEnabled())
   {
-    Write(EndBlock<true>, {{js.downcountAmount, js.numLoadStoreInst, js.numFloatingPointInst},
-                           js.curBlock->profile_data.get()});
+    emitter.Write(EndBlock<true>,
+                  {{js.downcountAmount, js.numLoadStoreInst, js.numFloatingPointInst},
+                   js.curBlock->profile_data.get()});
   }
   else
   {
-    Write(EndBlock<false>, {js.downcountAmount, js.numLoadStoreInst, js.numFloatingPointInst});
+    emitter.Write(EndBlock<false>,
+                  {js.downcountAmount, js.numLoadStoreInst, js.numFloatingPointInst});
   }
 }
 
@@ -341,6 +349,16 @@ void CachedInterpreter::Jit(u32 em_address, bool clear_cache_and_retry_on_failur
 
 bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
+  return EmitBlock(*this, *this, b, nextPC, code_block, m_code_buffer);
+}
+
+bool CachedInterpreter::EmitBlock(JitBase& jit, CachedInterpreterEmitter& emitter, JitBlock* b,
+                                  u32 nextPC, const PPCAnalyst::CodeBlock& code_block,
+                                  PPCAnalyst::CodeBuffer& code_buffer)
+{
+  auto& js = jit.js;
+  const u32 em_address = b->effectiveAddress;
+
   js.blockStart = em_address;
   js.firstFPInstructionFound = false;
   js.fifoBytesSinceCheck = 0;
@@ -349,17 +367,18 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   js.numFloatingPointInst = 0;
   js.curBlock = b;
 
-  auto& interpreter = m_system.GetInterpreter();
-  auto& power_pc = m_system.GetPowerPC();
-  auto& cpu = m_system.GetCPU();
+  auto& system = jit.m_system;
+  auto& interpreter = system.GetInterpreter();
+  auto& power_pc = system.GetPowerPC();
+  auto& cpu = system.GetCPU();
   auto& breakpoints = power_pc.GetBreakPoints();
 
-  if (IsProfilingEnabled())
-    Write(StartProfiledBlock, {js.curBlock->profile_data.get()});
+  if (jit.IsProfilingEnabled())
+    emitter.Write(StartProfiledBlock, {js.curBlock->profile_data.get()});
 
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
-    PPCAnalyst::CodeOp& op = m_code_buffer[i];
+    PPCAnalyst::CodeOp& op = code_buffer[i];
     js.op = &op;
 
     js.compilerPC = op.address;
@@ -370,55 +389,56 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     if (op.opinfo->flags & FL_USE_FPU)
       ++js.numFloatingPointInst;
 
-    if (HandleFunctionHooking(js.compilerPC))
+    if (HandleFunctionHooking(jit, emitter, js.compilerPC))
       break;
 
     if (!op.skip)
     {
-      if (IsDebuggingEnabled() && !cpu.IsStepping() &&
+      if (jit.IsDebuggingEnabled() && !cpu.IsStepping() &&
           breakpoints.IsAddressBreakPoint(js.compilerPC))
       {
-        Write(CheckBreakpoint, {power_pc, js.compilerPC, js.downcountAmount});
+        emitter.Write(CheckBreakpoint, {power_pc, js.compilerPC, js.downcountAmount});
       }
       if (!js.firstFPInstructionFound && (op.opinfo->flags & FL_USE_FPU) != 0)
       {
-        Write(CheckFPU, {power_pc, js.compilerPC, js.downcountAmount});
+        emitter.Write(CheckFPU, {power_pc, js.compilerPC, js.downcountAmount});
         js.firstFPInstructionFound = true;
       }
 
       // Instruction may cause a DSI Exception or Program Exception.
-      if ((jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
-          (!op.canEndBlock && ShouldHandleFPExceptionForInstruction(&op)))
+      if ((jit.jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
+          (!op.canEndBlock && jit.ShouldHandleFPExceptionForInstruction(&op)))
       {
         const InterpretAndCheckExceptionsOperands operands = {
             {interpreter, Interpreter::GetInterpreterOp(op.inst), js.compilerPC, op.inst},
             power_pc,
             js.downcountAmount};
-        Write(op.canEndBlock ? CallbackCast(InterpretAndCheckExceptions<true>) :
-                               CallbackCast(InterpretAndCheckExceptions<false>),
-              operands);
+        emitter.Write(op.canEndBlock ? CallbackCast(InterpretAndCheckExceptions<true>) :
+                                       CallbackCast(InterpretAndCheckExceptions<false>),
+                      operands);
       }
       else
       {
         const InterpretOperands operands = {interpreter, Interpreter::GetInterpreterOp(op.inst),
                                             js.compilerPC, op.inst};
-        Write(op.canEndBlock ? CallbackCast(Interpret<true>) : CallbackCast(Interpret<false>),
-              operands);
+        emitter.Write(op.canEndBlock ? CallbackCast(Interpret<true>) :
+                                       CallbackCast(Interpret<false>),
+                      operands);
       }
 
       if (op.branchIsIdleLoop)
-        Write(CheckIdle, {m_system.GetCoreTiming(), js.blockStart});
+        emitter.Write(CheckIdle, {system.GetCoreTiming(), js.blockStart});
       if (op.canEndBlock)
-        WriteEndBlock();
+        WriteEndBlock(jit, emitter);
     }
   }
   if (code_block.m_broken)
   {
-    Write(WriteBrokenBlockNPC, {nextPC});
-    WriteEndBlock();
+    emitter.Write(WriteBrokenBlockNPC, {nextPC});
+    WriteEndBlock(jit, emitter);
   }
 
-  if (HasWriteFailed())
+  if (emitter.HasWriteFailed())
   {
     WARN_LOG_FMT(DYNA_REC, "JIT ran out of space in code region during code generation.");
     return false;
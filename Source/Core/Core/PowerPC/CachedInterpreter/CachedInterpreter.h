@@ -46,6 +46,14 @@ public:
   void Jit(u32 address, bool clear_cache_and_retry_on_failure);
   bool DoJit(u32 address, JitBlock* b, u32 nextPC);
 
+  // Emits the callbacks for the block that jit has just analyzed into emitter. This is also used
+  // by Jit64 to generate cheap baseline code for blocks that haven't been executed much yet.
+  static bool EmitBlock(JitBase& jit, CachedInterpreterEmitter& emitter, JitBlock* b, u32 nextPC,
+                        const PPCAnalyst::CodeBlock& code_block,
+                        PPCAnalyst::CodeBuffer& code_buffer);
+  // Runs the callbacks starting at normal_entry until one of them exits the block.
+  static void ExecuteBlock(PowerPC::PowerPCState& ppc_state, const u8* normal_entry);
+
   void EraseSingleBlock(const JitBlock& block) override;
   std::vector<MemoryStats> GetMemoryStats() const override;
 
@@ -61,8 +69,8 @@ public:
 private:
   void ExecuteOneBlock();
 
-  bool HandleFunctionHooking(u32 address);
-  void WriteEndBlock();
+  static bool HandleFunctionHooking(JitBase& jit, CachedInterpreterEmitter& emitter, u32 address);
+  static void WriteEndBlock(JitBase& jit, CachedInterpreterEmitter& emitter);
 
   // Finds a free memory region and sets the code emitter to point at that region.
   // Returns false if no free memory region can be found.
@@ -72,6 +72,7 @@ Interpreter::~Interpreter() = default;
 
 void Interpreter::Init()
 {
+  m_decode_cache.fill({});
   m_end_block = false;
 }
 
@@ -115,6 +116,23 @@ bool Interpreter::HandleFunctionHooking(u32 address)
   return result.type != HLE::HookType::Start;
 }
 
+const Interpreter::DecodedInstruction& Interpreter::Decode(u32 physical_address,
+                                                           UGeckoInstruction inst)
+{
+  DecodedInstruction& entry = m_decode_cache[(physical_address >> 2) % DECODE_CACHE_SIZE];
+  if (entry.physical_address == physical_address && entry.inst.hex == inst.hex &&
+      m_decode_cache_enabled)
+  {
+    return entry;
+  }
+
+  entry.physical_address = physical_address;
+  entry.inst = inst;
+  entry.handler = GetInterpreterOp(inst);
+  entry.opinfo = PPCTables::GetOpInfo(inst, m_ppc_state.pc);
+  return entry;
+}
+
 int Interpreter::SingleStepInner()
 {
   if (HandleFunctionHooking(m_ppc_state.pc))
@@ -127,9 +145,25 @@ int Interpreter::SingleStepInner()
   }
 
   m_ppc_state.npc = m_ppc_state.pc + sizeof(UGeckoInstruction);
-  m_prev_inst.hex = m_mmu.Read_Opcode(m_ppc_state.pc);
 
-  const GekkoOPInfo* opinfo = PPCTables::GetOpInfo(m_prev_inst, m_ppc_state.pc);
+  // The instruction is still fetched every time so that the emulated instruction cache and
+  // self-modifying code behave exactly as before, only decoding it is skipped.
+  const PowerPC::TryReadInstResult fetch = m_mmu.TryReadInstruction(m_ppc_state.pc);
+  u32 physical_address = fetch.physical_address;
+  if (fetch.valid)
+  {
+    m_prev_inst.hex = fetch.hex;
+  }
+  else
+  {
+    // Read_Opcode raises the ISI. What the failed fetch gets decoded under doesn't matter, since
+    // a cache entry only depends on the instruction word.
+    m_prev_inst.hex = m_mmu.Read_Opcode(m_ppc_state.pc);
+    physical_address = m_ppc_state.pc;
+  }
+
+  const DecodedInstruction& decoded = Decode(physical_address, m_prev_inst);
+  const GekkoOPInfo* opinfo = decoded.opinfo;
 
   // Uncomment to trace the interpreter
   // if ((m_ppc_state.pc & 0x00FFFFFF) >= 0x000AB54C &&
@@ -156,7 +190,7 @@ int Interpreter::SingleStepInner()
     }
     else if (m_ppc_state.msr.FP)
     {
-      RunInterpreterOp(*this, m_prev_inst);
+      decoded.handler(*this, m_prev_inst);
       if ((m_ppc_state.Exceptions & EXCEPTION_DSI) != 0)
       {
         CheckExceptions();
@@ -172,7 +206,7 @@ int Interpreter::SingleStepInner()
       }
       else
       {
-        RunInterpreterOp(*this, m_prev_inst);
+        decoded.handler(*this, m_prev_inst);
         if ((m_ppc_state.Exceptions & EXCEPTION_DSI) != 0)
         {
           CheckExceptions();
@@ -316,7 +350,13 @@ void Interpreter::unknown_instruction(Interpreter& interpreter, UGeckoInstructio
 
 void Interpreter::ClearCache()
 {
-  // Do nothing.
+  m_decode_cache.fill({});
+}
+
+void Interpreter::SetDecodeCacheEnabled(bool enabled)
+{
+  m_decode_cache_enabled = enabled;
+  m_decode_cache.fill({});
 }
 
 void Interpreter::CheckExceptions()
@@ -20,6 +20,7 @@ class MMU;
 struct PowerPCState;
 }  // namespace PowerPC
 class PPCSymbolDB;
+struct GekkoOPInfo;
 
 class Interpreter : public CPUCoreBase
 {
@@ -41,6 +42,10 @@ public:
   void ClearCache() override;
   const char* GetName() const override;
 
+  // Lets benchmarks compare the decode cache to decoding every instruction as it's executed. The
+  // cache is always enabled otherwise.
+  void SetDecodeCacheEnabled(bool enabled);
+
   static void unknown_instruction(Interpreter& interpreter, UGeckoInstruction inst);
 
   // Branch Instructions
@@ -295,8 +300,24 @@ public:
   static u32 Helper_Carry(u32 value1, u32 value2);
 
 private:
+  // An instruction word along with everything SingleStepInner needs to know to execute it.
+  struct DecodedInstruction
+  {
+    // Instructions are word aligned, so this never matches before the entry has been filled.
+    u32 physical_address = 0xFFFFFFFF;
+    UGeckoInstruction inst{};
+    Instruction handler = nullptr;
+    const GekkoOPInfo* opinfo = nullptr;
+  };
+
+  // Direct mapped, indexed by the physical address of the instruction. At 24 bytes per entry, this
+  // covers 16 KiB of code in 96 KiB.
+  static constexpr u32 DECODE_CACHE_SIZE = 0x1000;
+
   void CheckExceptions();
 
+  const DecodedInstruction& Decode(u32 physical_address, UGeckoInstruction inst);
+
   bool HandleFunctionHooking(u32 address);
 
   // flag helper
@@ -322,6 +343,9 @@ private:
   Core::BranchWatch& m_branch_watch;
   PPCSymbolDB& m_ppc_symbol_db;
 
+  std::array<DecodedInstruction, DECODE_CACHE_SIZE> m_decode_cache{};
+  bool m_decode_cache_enabled = true;
+
   UGeckoInstruction m_prev_inst{};
   u32 m_last_pc = 0;
   bool m_end_block = false;
@@ -3,7 +3,9 @@
 
 #include "Core/PowerPC/Jit64/Jit.h"
 
+#include <algorithm>
 #include <map>
+#include <mutex>
 #include <span>
 #include <sstream>
 #include <string>
@@ -24,6 +26,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
 #include "Common/x64ABI.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -34,6 +37,7 @@
 #include "Core/Host.h"
 #include "Core/MachineContext.h"
 #include "Core/PatchEngine.h"
+#include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/Jit64/JitAsm.h"
 #include "Core/PowerPC/Jit64/RegCache/JitRegCache.h"
@@ -129,6 +133,12 @@ Jit64::~Jit64() = default;
 
 bool Jit64::HandleFault(uintptr_t access_address, SContext* ctx)
 {
+  // Both backpatching and stack fault handling change code and state that the tier-up thread may
+  // be using, so the handler waits for any background compile to finish. This can't deadlock: the
+  // faults handled here come from emulated code on the CPU thread, which never runs while that
+  // thread holds m_codegen_mutex, and the tier-up thread doesn't run emulated code.
+  std::lock_guard lk(m_codegen_mutex);
+
   const uintptr_t stack_guard = reinterpret_cast<uintptr_t>(m_stack_guard);
   // In the trap region?
   if (m_enable_blr_optimization && access_address >= stack_guard &&
@@ -258,6 +268,7 @@ void Jit64::Init()
   InitFastmemArena();
 
   RefreshConfig();
+  RefreshTieringConfig();
 
   EnableBlockLink();
 
@@ -297,12 +308,19 @@ void Jit64::Init()
   code_block.m_gpa = &js.gpa;
   code_block.m_fpa = &js.fpa;
   EnableOptimization();
+  analyzer.SetBranchPredictor(
+      [this](u32 address, u32 target) { return IsBranchUsuallyTaken(address, target); });
 
   ResetFreeMemoryRanges();
 }
 
 void Jit64::ClearCache()
 {
+  std::lock_guard lk(m_codegen_mutex);
+
+  // The code of finished jobs is about to be discarded along with everything else.
+  m_tier_up_jobs.clear();
+
   blocks.Clear();
   blocks.ClearRangesToFree();
   trampolines.ClearCodeSpace();
@@ -311,6 +329,7 @@ void Jit64::ClearCache()
   ClearCodeSpace();
   Clear();
   RefreshConfig();
+  RefreshTieringConfig();
   asm_routines.Regenerate();
   ResetFreeMemoryRanges();
   Host_JitCacheInvalidation();
@@ -324,9 +343,29 @@ void Jit64::FreeRanges()
     m_free_ranges_near.insert(from, to);
   for (const auto& [from, to] : blocks.GetRangesToFreeFar())
     m_free_ranges_far.insert(from, to);
+  for (const u64 job_id : blocks.GetOrphanedTierUpJobs())
+    DropTierUpJob(job_id);
   blocks.ClearRangesToFree();
 }
 
+void Jit64::MarkCodeRangesUsed(JitBlock* b, u8* near_start, u8* far_start)
+{
+  // Mark the memory regions that this code block uses as used in the local rangesets.
+  u8* near_end = GetWritableCodePtr();
+  if (near_start != near_end)
+    m_free_ranges_near.erase(near_start, near_end);
+  u8* far_end = m_far_code.GetWritableCodePtr();
+  if (far_start != far_end)
+    m_free_ranges_far.erase(far_start, far_end);
+
+  // Store the used memory regions in the block so we know what to mark as unused when the
+  // block gets invalidated.
+  b->near_begin = near_start;
+  b->near_end = near_end;
+  b->far_begin = far_start;
+  b->far_end = far_end;
+}
+
 void Jit64::ResetFreeMemoryRanges()
 {
   // Set the entire near and far code regions as unused.
@@ -334,10 +373,161 @@ void Jit64::ResetFreeMemoryRanges()
   m_free_ranges_near.insert(region, region + region_size);
   m_free_ranges_far.clear();
   m_free_ranges_far.insert(m_far_code.GetWritableCodePtr(), m_far_code.GetWritableCodeEnd());
+  m_far_code_size = m_far_code.GetWritableCodeEnd() - m_far_code.GetWritableCodePtr();
+}
+
+bool Jit64::EvictColdBlocks()
+{
+  blocks.SweepRecentlyRunBlocks();
+  m_blocks_compiled_since_sweep = 0;
+
+  const std::vector<const JitBlock*> candidates =
+      blocks.GetBlocksByHeat([this](const JitBlock& block) { return GetBlockHeat(block); });
+
+  // The ranges of erased blocks only get added to the free ranges by FreeRanges, so keep count of
+  // the free space here rather than querying the range sets for every block.
+  std::size_t free_near = m_free_ranges_near.get_stats().first;
+  std::size_t free_far = m_free_ranges_far.get_stats().first;
+  const std::size_t target_near = region_size / EVICTION_FREE_SPACE_DIVISOR;
+  const std::size_t target_far = m_far_code_size / EVICTION_FREE_SPACE_DIVISOR;
+
+  // Blocks that have run since the last sweep are still in use, and evicting them would only get
+  // them compiled again right away.
+  const u32 current_sweep = blocks.GetCurrentSweep();
+  std::size_t evicted = 0;
+  for (const JitBlock* block : candidates)
+  {
+    if (free_near >= target_near && free_far >= target_far)
+      break;
+    if (block->last_run_sweep == current_sweep)
+      return false;
+
+    free_near += block->near_end - block->near_begin;
+    free_far += block->far_end - block->far_begin;
+    ++evicted;
+  }
+
+  // If nothing had to be evicted, the free space is merely too fragmented.
+  if (evicted == 0)
+    return false;
+
+  for (std::size_t i = 0; i < evicted; ++i)
+    blocks.EraseSingleBlock(*candidates[i]);
+  FreeRanges();
+
+  WARN_LOG_FMT(DYNA_REC, "Evicted {} of {} blocks to free code space", evicted, candidates.size());
+  return true;
+}
+
+u64 Jit64::GetBlockHeat(const JitBlock& block) const
+{
+  // Blocks are ranked by when they last ran, and then by how often they have run, where known.
+  u64 run_count = 0;
+  if (block.profile_data)
+    run_count = block.profile_data->run_count;
+  else if (!block.is_baseline || block.tier_up_job_id != 0)
+    run_count = m_tiered_compilation ? m_tier_up_threshold : 0;
+  else
+    run_count = m_tier_up_threshold - block.tier_up_countdown;
+
+  return u64(block.last_run_sweep) << 32 | std::min<u64>(run_count, UINT32_MAX);
+}
+
+void Jit64::EmitRanSinceSweep(JitBlock* b)
+{
+  b->ran_since_sweep = std::make_unique<u8>(0);
+  MOV(64, R(RSCRATCH), ImmPtr(b->ran_since_sweep.get()));
+  MOV(8, MatR(RSCRATCH), Imm8(1));
+}
+
+void Jit64::RefreshTieringConfig()
+{
+  m_tiered_compilation = Config::Get(Config::MAIN_JIT_TIERED_COMPILATION);
+  m_tier_up_threshold = std::max(Config::Get(Config::MAIN_JIT_TIER_UP_THRESHOLD), 1u);
+
+  // Superblocks are formed using the execution counts kept by baseline blocks.
+  if (m_enable_superblocks && m_tiered_compilation)
+    analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_FOLLOW_HOT_BRANCHES);
+  else
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_FOLLOW_HOT_BRANCHES);
+
+  // Background compilation can be turned on while the game is running. The thread is left running
+  // when it gets turned off again, since it can't be joined while m_codegen_mutex is held; it just
+  // doesn't get any more jobs.
+  if (m_enable_background_compilation && !m_tier_up_thread_running)
+  {
+    m_tier_up_thread.Reset("JIT Tier-Up");
+    m_tier_up_thread_running = true;
+  }
+}
+
+u32 Jit64::GetExecutionCount(u32 em_address)
+{
+  const JitBlock* block = blocks.GetBlockFromStartAddress(em_address, m_ppc_state.feature_flags);
+  if (!block)
+    return 0;
+
+  // Blocks that have been tiered up have run at least as often as the threshold.
+  if (!block->is_baseline || block->tier_up_job_id != 0)
+    return m_tier_up_threshold;
+
+  return m_tier_up_threshold - block->tier_up_countdown;
+}
+
+bool Jit64::IsBranchUsuallyTaken(u32 address, u32 target)
+{
+  if (IsDebuggingEnabled())
+    return false;
+
+  // Each baseline block ends at its first conditional branch, so the blocks at the two possible
+  // destinations have counted how often the branch went either way (at least when the code isn't
+  // also reached from elsewhere).
+  const u32 taken_count = GetExecutionCount(target);
+  const u32 not_taken_count = GetExecutionCount(address + 4);
+  return taken_count * 2 >= m_tier_up_threshold &&
+         taken_count >= u64(not_taken_count) * SUPERBLOCK_MIN_TAKEN_RATIO;
+}
+
+void Jit64::CaptureSpeculationValues(u32 em_address, SpeculationValues* values)
+{
+  std::copy_n(m_ppc_state.gpr, values->gpr.size(), values->gpr.begin());
+  for (size_t i = 0; i < values->gqr.size(); ++i)
+    values->gqr[i] = GQR(m_ppc_state, i);
+
+  values->entry_address_gprs = BitSet32{};
+  const JitBlock::LinkData* predecessor =
+      blocks.GetSinglePredecessorExit(em_address, m_ppc_state.feature_flags);
+  if (predecessor)
+  {
+    for (const auto& [gpr, address] : predecessor->known_addresses)
+    {
+      values->entry_address_gprs[gpr] = true;
+      values->entry_addresses[gpr] = address;
+    }
+  }
+}
+
+void Jit64::RecordKnownAddresses(JitBlock::LinkData* link_data) const
+{
+  for (const int i : m_constant_propagation.GetKnownGPRs())
+  {
+    const u32 value = m_constant_propagation.GetGPR(i);
+    if (IsOptimizableRAMAddress(value, 32) || IsOptimizableMMIOAccess(value, 32) ||
+        IsOptimizableGatherPipeWrite(value))
+    {
+      link_data->known_addresses.emplace_back(static_cast<u8>(i), value);
+    }
+  }
 }
 
 void Jit64::Shutdown()
 {
+  // Jobs that are still queued have nothing left to do once their code space is gone.
+  m_tier_up_thread.Cancel();
+  m_tier_up_thread.Shutdown();
+  m_tier_up_thread_running = false;
+  m_tier_up_jobs.clear();
+
   FreeCodeSpace();
 
   auto& memory = m_system.GetMemory();
@@ -386,8 +576,9 @@ void Jit64::FallBackToInterpreter(UGeckoInstruction inst)
     }
     else
     {
+      const u32 next_address = js.op->branchFollowed ? js.op->branchTo : js.compilerPC + 4;
       MOV(32, R(RSCRATCH), PPCSTATE(npc));
-      CMP(32, R(RSCRATCH), Imm32(js.compilerPC + 4));
+      CMP(32, R(RSCRATCH), Imm32(next_address));
       FixupBranch c = J_CC(CC_Z);
       MOV(32, PPCSTATE(pc), R(RSCRATCH));
       WriteExceptionExit();
@@ -468,7 +659,7 @@ bool Jit64::Cleanup()
     did_something = true;
   }
 
-  if (m_ppc_state.feature_flags & FEATURE_FLAG_PERFMON)
+  if (js.curBlock->feature_flags & FEATURE_FLAG_PERFMON)
   {
     ABI_PushRegistersAndAdjustStack({}, 0);
     ABI_CallFunctionCCCP(PowerPC::UpdatePerformanceMonitor, js.downcountAmount, js.numLoadStoreInst,
@@ -496,7 +687,7 @@ void Jit64::FakeBLCall(u32 after)
 
   // We may need to fake the BLR stack on inlined CALL instructions.
   // Else we can't return to this location any more.
-  MOV(64, R(RSCRATCH2), Imm64(u64(m_ppc_state.feature_flags) << 32 | after));
+  MOV(64, R(RSCRATCH2), Imm64(u64(js.curBlock->feature_flags) << 32 | after));
   PUSH(RSCRATCH2);
   FixupBranch skip_exit = CALL();
   POP(RSCRATCH2);
@@ -534,7 +725,7 @@ void Jit64::MSRUpdated(const OpArg& msr, X64Reg scratch_reg)
   static_assert(UReg_MSR{}.IR.StartBit() == 5);
   static_assert(FEATURE_FLAG_MSR_DR == 1 << 0);
   static_assert(FEATURE_FLAG_MSR_IR == 1 << 1);
-  const u32 other_feature_flags = m_ppc_state.feature_flags & ~0x3;
+  const u32 other_feature_flags = js.curBlock->feature_flags & ~0x3;
   if (msr.IsImm())
   {
     MOV(32, PPCSTATE(feature_flags), Imm32(other_feature_flags | ((msr.Imm32() >> 4) & 0x3)));
@@ -559,13 +750,16 @@ void Jit64::WriteExit(u32 destination, bool bl, u32 after)
 
   if (bl)
   {
-    MOV(64, R(RSCRATCH2), Imm64(u64(m_ppc_state.feature_flags) << 32 | after));
+    MOV(64, R(RSCRATCH2), Imm64(u64(js.curBlock->feature_flags) << 32 | after));
     PUSH(RSCRATCH2);
   }
 
   SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
 
   JustWriteExit(destination, bl, after);
+
+  // JustWriteExit adds the link to the destination last.
+  RecordKnownAddresses(&js.curBlock->linkData.back());
 }
 
 void Jit64::JustWriteExit(u32 destination, bool bl, u32 after)
@@ -619,7 +813,7 @@ void Jit64::WriteExitDestInRSCRATCH(bool bl, u32 after)
 
   if (bl)
   {
-    MOV(64, R(RSCRATCH2), Imm64(u64(m_ppc_state.feature_flags) << 32 | after));
+    MOV(64, R(RSCRATCH2), Imm64(u64(js.curBlock->feature_flags) << 32 | after));
     PUSH(RSCRATCH2);
   }
 
@@ -647,9 +841,9 @@ void Jit64::WriteBLRExit()
   bool disturbed = Cleanup();
   if (disturbed)
     MOV(32, R(RSCRATCH), PPCSTATE(pc));
-  if (m_ppc_state.feature_flags != 0)
+  if (js.curBlock->feature_flags != 0)
   {
-    MOV(32, R(RSCRATCH2), Imm32(m_ppc_state.feature_flags));
+    MOV(32, R(RSCRATCH2), Imm32(js.curBlock->feature_flags));
     SHL(64, R(RSCRATCH2), Imm8(32));
     OR(64, R(RSCRATCH), R(RSCRATCH2));
   }
@@ -758,11 +952,18 @@ void Jit64::Trace()
 
 void Jit64::Jit(u32 em_address)
 {
-  Jit(em_address, true);
+  Jit(em_address, OnCodeSpaceExhausted::EvictColdBlocks);
 }
 
-void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
+void Jit64::TierUpFromJIT(Jit64& jit, u32 em_address)
 {
+  jit.TierUp(em_address);
+}
+
+void Jit64::Jit(u32 em_address, OnCodeSpaceExhausted on_exhausted, bool tier_up)
+{
+  std::lock_guard lk(m_codegen_mutex);
+
   CleanUpAfterStackFault();
 
   if (trampolines.IsAlmostFull() || SConfig::GetInstance().bJITNoBlockCache)
@@ -801,11 +1002,27 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  // Blocks start out in the baseline tier unless they are known to be hot. Debugging always uses
+  // the optimizing tier, since the baseline tier doesn't support stepping or branch watching.
+  const bool baseline = m_tiered_compilation && !tier_up && !IsDebuggingEnabled();
+  if (baseline)
+  {
+    // Interpreted instructions can't be merged, and every branch has to end the block.
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  }
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
+  if (baseline)
+    EnableOptimization();
+
   if (code_block.m_memory_exception)
   {
     // Address of instruction could not be translated
@@ -822,43 +1039,63 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     u8* near_start = GetWritableCodePtr();
     u8* far_start = m_far_code.GetWritableCodePtr();
 
+    // A block that gets tiered up takes the place of its baseline block.
+    const JitBlock* baseline_block =
+        tier_up ? blocks.GetBlockFromStartAddress(em_address, m_ppc_state.feature_flags) : nullptr;
+    if (baseline_block && !baseline_block->is_baseline)
+      baseline_block = nullptr;
+
+    if (!baseline)
+      CaptureSpeculationValues(em_address, &m_speculation_values);
+
     JitBlock* b = blocks.AllocateBlock(em_address);
-    if (DoJit(em_address, b, nextPC))
+    if (baseline ? DoBaselineJit(b, nextPC) : DoJit(em_address, b, nextPC))
     {
       // Code generation succeeded.
+      MarkCodeRangesUsed(b, near_start, far_start);
 
-      // Mark the memory regions that this code block uses as used in the local rangesets.
-      u8* near_end = GetWritableCodePtr();
-      if (near_start != near_end)
-        m_free_ranges_near.erase(near_start, near_end);
-      u8* far_end = m_far_code.GetWritableCodePtr();
-      if (far_start != far_end)
-        m_free_ranges_far.erase(far_start, far_end);
-
-      // Store the used memory regions in the block so we know what to mark as unused when the
-      // block gets invalidated.
-      b->near_begin = near_start;
-      b->near_end = near_end;
-      b->far_begin = far_start;
-      b->far_end = far_end;
+      if (baseline_block)
+        blocks.ReplaceBlock(*baseline_block, *b, jo.enableBlocklink, code_block, m_code_buffer);
+      else
+        blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
 
-      blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
+      // Time is measured in compiled blocks for the purpose of eviction, since code space only
+      // runs out while compiling.
+      if (++m_blocks_compiled_since_sweep == BLOCKS_PER_SWEEP)
+      {
+        blocks.SweepRecentlyRunBlocks();
+        m_blocks_compiled_since_sweep = 0;
+      }
 
 #ifdef JIT_LOG_GENERATED_CODE
       LogGeneratedCode();
 #endif
       return;
     }
+
+    blocks.DiscardBlock(*b);
   }
 
-  if (clear_cache_and_retry_on_failure)
+  // Code generation failed due to not enough free space in either the near or far code regions.
+  switch (on_exhausted)
   {
-    // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+  case OnCodeSpaceExhausted::EvictColdBlocks:
+    // Make room by evicting the blocks that have gone the longest without running. If the block
+    // still doesn't fit because the free space is too fragmented, the retry clears the entire JIT
+    // cache.
+    if (EvictColdBlocks())
+    {
+      Jit(em_address, OnCodeSpaceExhausted::ClearCache, tier_up);
+      return;
+    }
+    [[fallthrough]];
+  case OnCodeSpaceExhausted::ClearCache:
     WARN_LOG_FMT(DYNA_REC, "flushing code caches, please report if this happens a lot");
     ClearCache();
-    Jit(em_address, false);
+    Jit(em_address, OnCodeSpaceExhausted::Fail, tier_up);
     return;
+  case OnCodeSpaceExhausted::Fail:
+    break;
   }
 
   PanicAlertFmtT("JIT failed to find code space after a cache clear. This should never happen. "
@@ -902,6 +1139,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
   // TODO: Test if this or AlignCode16 make a difference from GetCodePtr
   b->normalEntry = AlignCode4();
+  EmitRanSinceSweep(b);
 
   // Used to get a trace of the last few blocks before a crash, sometimes VERY useful
   if (m_im_here_debug)
@@ -925,6 +1163,14 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   gpr.Start();
   fpr.Start();
 
+  if (m_enable_linear_scan_register_allocation && !bJITRegisterCacheOff)
+  {
+    const std::span<const PPCAnalyst::CodeOp> ops(m_code_buffer.data(),
+                                                  code_block.m_num_instructions);
+    gpr.PlanAllocation(ops);
+    fpr.PlanAllocation(ops);
+  }
+
   m_constant_propagation.Clear();
 
   js.downcountAmount = 0;
@@ -955,7 +1201,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       // the start of the block in case our guess turns out wrong.
       for (int gqr : gqr_static)
       {
-        u32 value = GQR(m_ppc_state, gqr);
+        u32 value = m_speculation_values.gqr[gqr];
         js.constantGqr[gqr] = value;
         CMP_or_TEST(32, PPCSTATE_SPR(SPR_GQR0 + gqr), Imm32(value));
         J_CC(CC_NZ, target);
@@ -964,10 +1210,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     }
   }
 
-  if (!js.noSpeculativeConstantsAddresses.contains(js.blockStart))
-  {
-    IntializeSpeculativeConstants();
-  }
+  IntializeSpeculativeConstants();
 
   // Translate instructions
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
@@ -1257,8 +1500,216 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   return true;
 }
 
+bool Jit64::DoBaselineJit(JitBlock* b, u32 nextPC)
+{
+  b->is_baseline = true;
+  b->tier_up_countdown = m_tier_up_threshold;
+
+  b->normalEntry = AlignCode4();
+  EmitRanSinceSweep(b);
+
+  // Count how often the block runs, and have it recompiled once it has become hot.
+  MOV(64, R(RSCRATCH), ImmPtr(&b->tier_up_countdown));
+  SUB(32, MatR(RSCRATCH), Imm8(1));
+  FixupBranch tier_up = J_CC(CC_Z, Jump::Near);
+
+  SwitchToFarCode();
+  SetJumpTarget(tier_up);
+  MOV(32, PPCSTATE(pc), Imm32(b->effectiveAddress));
+  JMP(asm_routines.tier_up, true);
+
+  // The callbacks are stored in far code so that they get freed together with the block.
+  u8* callbacks = AlignCode16();
+  CachedInterpreterEmitter emitter(callbacks, GetWritableCodeEnd());
+  const bool emitted =
+      CachedInterpreter::EmitBlock(*this, emitter, b, nextPC, code_block, m_code_buffer);
+  SetCodePtr(emitter.GetWritableCodePtr(), GetWritableCodeEnd(),
+             HasWriteFailed() || emitter.HasWriteFailed());
+  SwitchToNearCode();
+
+  ABI_PushRegistersAndAdjustStack({}, 0);
+  ABI_CallFunctionPP(CachedInterpreter::ExecuteBlock, &m_ppc_state, callbacks);
+  ABI_PopRegistersAndAdjustStack({}, 0);
+
+  // The callbacks have already updated pc and downcount. Any exceptions raised by the interpreted
+  // instructions are handled the same way as after falling back to the interpreter.
+  CMP(32, PPCSTATE(Exceptions), Imm8(0));
+  FixupBranch no_exceptions = J_CC(CC_E);
+  MOV(32, R(RSCRATCH), PPCSTATE(pc));
+  MOV(32, PPCSTATE(npc), R(RSCRATCH));
+  ABI_PushRegistersAndAdjustStack({}, 0);
+  ABI_CallFunctionP(PowerPC::CheckExceptionsFromJIT, &m_system.GetPowerPC());
+  ABI_PopRegistersAndAdjustStack({}, 0);
+  SetJumpTarget(no_exceptions);
+
+  EmitUpdateMembase();
+  CMP(32, PPCSTATE(downcount), Imm8(0));
+  JMP(asm_routines.dispatcher, true);
+
+  if (!emitted)
+    return false;
+
+  if (HasWriteFailed() || m_far_code.HasWriteFailed())
+  {
+    WARN_LOG_FMT(DYNA_REC, "JIT ran out of space in code region during code generation.");
+    return false;
+  }
+
+  return true;
+}
+
+void Jit64::TierUp(u32 em_address)
+{
+  std::unique_lock lk(m_codegen_mutex);
+
+  JitBlock* block = blocks.GetBlockFromStartAddress(em_address, m_ppc_state.feature_flags);
+  if (block && block->is_baseline && m_enable_background_compilation)
+  {
+    if (block->tier_up_job_id != 0)
+    {
+      if (PublishTierUp(*block, lk))
+        return;
+    }
+    else if (QueueTierUp(*block))
+    {
+      // Keep running the baseline block while the optimized version is being compiled. It only
+      // takes the baseline block's place once the countdown expires again rather than as soon as
+      // it is ready, so that when the switch happens doesn't depend on how fast the host is.
+      block->tier_up_countdown = m_tier_up_threshold;
+      return;
+    }
+  }
+
+  Jit(em_address, OnCodeSpaceExhausted::EvictColdBlocks, true);
+}
+
+bool Jit64::QueueTierUp(JitBlock& baseline_block)
+{
+  // Code generation for memchecks reads the conditions of the memchecks, which the host can change
+  // at any time.
+  if (m_system.GetPowerPC().GetMemChecks().HasAny())
+    return false;
+
+  // Analysis can raise exceptions and update the TLB, so it has to happen on the CPU thread.
+  const u32 nextPC = analyzer.Analyze(baseline_block.effectiveAddress, &code_block, &m_code_buffer,
+                                      m_code_buffer.size());
+  if (code_block.m_memory_exception)
+    return false;
+
+  // The HLE function table isn't safe to access from another thread.
+  for (u32 i = 0; i < code_block.m_num_instructions; ++i)
+  {
+    if (HLE::TryReplaceFunction(m_ppc_symbol_db, m_code_buffer[i].address,
+                                PowerPC::CoreMode::JIT))
+    {
+      return false;
+    }
+  }
+
+  auto job = std::make_unique<TierUpJob>(blocks.CreateBlock(baseline_block.effectiveAddress));
+  job->code_block = code_block;
+  job->code_buffer.assign(m_code_buffer.begin(),
+                          m_code_buffer.begin() + code_block.m_num_instructions);
+  job->st = js.st;
+  job->gpa = js.gpa;
+  job->fpa = js.fpa;
+  job->next_pc = nextPC;
+  CaptureSpeculationValues(baseline_block.effectiveAddress, &job->speculation_values);
+
+  // The CPU thread changes the MSR and the DBATs while the job is being compiled. If the DBATs
+  // change, the block cache is cleared, which drops this job.
+  job->mmu_state = m_mmu.GetOptimizationState();
+  job->mmu_state.msr_dr = (baseline_block.feature_flags & FEATURE_FLAG_MSR_DR) != 0;
+
+  const u64 job_id = m_next_tier_up_job_id++;
+  m_tier_up_jobs.emplace(job_id, std::move(job));
+  baseline_block.tier_up_job_id = job_id;
+  m_tier_up_thread.Push([this, job_id] { CompileTierUp(job_id); });
+  return true;
+}
+
+void Jit64::CompileTierUp(u64 job_id)
+{
+  std::lock_guard lk(m_codegen_mutex);
+
+  // The job is gone if its block has been invalidated in the meantime.
+  const auto it = m_tier_up_jobs.find(job_id);
+  if (it == m_tier_up_jobs.end())
+    return;
+  TierUpJob& job = *it->second;
+
+  code_block = job.code_block;
+  std::ranges::copy(job.code_buffer, m_code_buffer.begin());
+  js.st = job.st;
+  js.gpa = job.gpa;
+  js.fpa = job.fpa;
+  m_speculation_values = job.speculation_values;
+  m_background_mmu_state = job.mmu_state;
+
+  job.state = TierUpJob::State::Failed;
+  if (SetEmitterStateToFreeCodeRegion())
+  {
+    u8* near_start = GetWritableCodePtr();
+    u8* far_start = m_far_code.GetWritableCodePtr();
+
+    m_compiling_in_background = true;
+    const bool compiled = DoJit(job.block.effectiveAddress, &job.block, job.next_pc);
+    m_compiling_in_background = false;
+
+    if (compiled)
+    {
+      MarkCodeRangesUsed(&job.block, near_start, far_start);
+      job.state = TierUpJob::State::Compiled;
+    }
+  }
+  m_background_mmu_state = {};
+
+  m_tier_up_job_done.notify_all();
+}
+
+bool Jit64::PublishTierUp(JitBlock& baseline_block, std::unique_lock<std::recursive_mutex>& lock)
+{
+  const u64 job_id = baseline_block.tier_up_job_id;
+  baseline_block.tier_up_job_id = 0;
+
+  const auto it = m_tier_up_jobs.find(job_id);
+  if (it == m_tier_up_jobs.end())
+    return false;
+
+  // Only this thread removes jobs, so the iterator stays valid while waiting.
+  m_tier_up_job_done.wait(lock, [&it] { return it->second->state != TierUpJob::State::Queued; });
+
+  const std::unique_ptr<TierUpJob> job = std::move(it->second);
+  m_tier_up_jobs.erase(it);
+  if (job->state != TierUpJob::State::Compiled)
+    return false;
+
+  JitBlock* b = blocks.InsertBlock(std::move(job->block));
+  blocks.ReplaceBlock(baseline_block, *b, jo.enableBlocklink, job->code_block, job->code_buffer);
+  return true;
+}
+
+void Jit64::DropTierUpJob(u64 job_id)
+{
+  const auto it = m_tier_up_jobs.find(job_id);
+  if (it == m_tier_up_jobs.end())
+    return;
+
+  const TierUpJob& job = *it->second;
+  if (job.state == TierUpJob::State::Compiled)
+  {
+    if (job.block.near_begin != job.block.near_end)
+      m_free_ranges_near.insert(job.block.near_begin, job.block.near_end);
+    if (job.block.far_begin != job.block.far_end)
+      m_free_ranges_far.insert(job.block.far_begin, job.block.far_end);
+  }
+  m_tier_up_jobs.erase(it);
+}
+
 void Jit64::EraseSingleBlock(const JitBlock& block)
 {
+  std::lock_guard lk(m_codegen_mutex);
+
   blocks.EraseSingleBlock(block);
   FreeRanges();
 }
@@ -1313,26 +1764,67 @@ void Jit64::IntializeSpeculativeConstants()
   // the first block loads the constant.
   // Insert a check at the start of the block to verify that the value is actually constant.
   // This can save a lot of backpatching and optimize gather pipe writes in more places.
-  const u8* target = nullptr;
+  //
+  // Likewise, if the only block that links to this one leaves a known address in a register that
+  // this block uses as the base of a load or store, specialize on that address so that the access
+  // can go directly to RAM or to the MMIO handler. The check at the start of the block catches
+  // other predecessors, in which case the block gets recompiled without this kind of speculation.
+  // The two kinds are turned off separately, so that a block which is reached from more than one
+  // place still gets specialized for the gather pipe.
+  const bool speculate_constants = !js.noSpeculativeConstantsAddresses.contains(js.blockStart);
+  const bool speculate_entry_addresses =
+      !js.noEntryAddressSpeculationAddresses.contains(js.blockStart);
+  if (!speculate_constants && !speculate_entry_addresses)
+    return;
+
+  BitSet32 address_gprs;
+  if (speculate_entry_addresses)
+  {
+    for (u32 i = 0; i < code_block.m_num_instructions; i++)
+    {
+      const PPCAnalyst::CodeOp& op = m_code_buffer[i];
+      if ((op.opinfo->flags & FL_LOADSTORE) && op.inst.RA != 0)
+        address_gprs[op.inst.RA] = true;
+    }
+  }
+
+  const u8* constants_target = nullptr;
+  const u8* entry_addresses_target = nullptr;
+  const auto get_target = [this](const u8*& target, JitInterface::ExceptionType type) {
+    if (!target)
+    {
+      SwitchToFarCode();
+      target = GetCodePtr();
+      MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+      ABI_PushRegistersAndAdjustStack({}, 0);
+      ABI_CallFunctionPC(JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
+                         static_cast<u32>(type));
+      ABI_PopRegistersAndAdjustStack({}, 0);
+      JMP(asm_routines.dispatcher_no_check);
+      SwitchToNearCode();
+    }
+    return target;
+  };
+
   for (auto i : code_block.m_gpr_inputs)
   {
-    u32 compileTimeValue = m_ppc_state.gpr[i];
-    if (m_mmu.IsOptimizableGatherPipeWrite(compileTimeValue) ||
-        m_mmu.IsOptimizableGatherPipeWrite(compileTimeValue - 0x8000) ||
-        compileTimeValue == 0xCC000000)
+    u32 compileTimeValue = m_speculation_values.gpr[i];
+    const u8* target = nullptr;
+    if (speculate_constants && (IsOptimizableGatherPipeWrite(compileTimeValue) ||
+                                IsOptimizableGatherPipeWrite(compileTimeValue - 0x8000) ||
+                                compileTimeValue == 0xCC000000))
+    {
+      target = get_target(constants_target, JitInterface::ExceptionType::SpeculativeConstants);
+    }
+    else if (address_gprs[i] && m_speculation_values.entry_address_gprs[i])
+    {
+      compileTimeValue = m_speculation_values.entry_addresses[i];
+      target = get_target(entry_addresses_target,
+                          JitInterface::ExceptionType::EntryAddressSpeculation);
+    }
+
+    if (target)
     {
-      if (!target)
-      {
-        SwitchToFarCode();
-        target = GetCodePtr();
-        MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
-        ABI_PushRegistersAndAdjustStack({}, 0);
-        ABI_CallFunctionPC(JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
-                           static_cast<u32>(JitInterface::ExceptionType::SpeculativeConstants));
-        ABI_PopRegistersAndAdjustStack({}, 0);
-        JMP(asm_routines.dispatcher_no_check);
-        SwitchToNearCode();
-      }
       CMP(32, PPCSTATE_GPR(i), Imm32(compileTimeValue));
       J_CC(CC_NZ, target);
       gpr.SetImmediate32(i, compileTimeValue, false);
@@ -1342,6 +1834,10 @@ void Jit64::IntializeSpeculativeConstants()
 
 void Jit64::FlushRegistersBeforeSlowAccess()
 {
+  // Blocks are never compiled in the background while there are memchecks, see QueueTierUp.
+  if (m_compiling_in_background)
+    return;
+
   // Register values can be used by memory watchpoint conditions.
   MemChecks& mem_checks = m_system.GetPowerPC().GetMemChecks();
   if (mem_checks.HasAny())
@@ -1359,8 +1855,47 @@ void Jit64::FlushRegistersBeforeSlowAccess()
   }
 }
 
+bool Jit64::IsOptimizableRAMAddress(u32 address, u32 access_size) const
+{
+  if (m_compiling_in_background)
+    return m_mmu.IsOptimizableRAMAddress(m_background_mmu_state, address, access_size);
+  return m_mmu.IsOptimizableRAMAddress(address, access_size);
+}
+
+u32 Jit64::IsOptimizableMMIOAccess(u32 address, u32 access_size) const
+{
+  if (m_compiling_in_background)
+    return m_mmu.IsOptimizableMMIOAccess(m_background_mmu_state, address, access_size);
+  return m_mmu.IsOptimizableMMIOAccess(address, access_size);
+}
+
+bool Jit64::IsOptimizableGatherPipeWrite(u32 address) const
+{
+  if (m_compiling_in_background)
+    return m_mmu.IsOptimizableGatherPipeWrite(m_background_mmu_state, address);
+  return m_mmu.IsOptimizableGatherPipeWrite(address);
+}
+
+bool Jit64::IsDataTranslationEnabled() const
+{
+  if (m_compiling_in_background)
+    return m_background_mmu_state.msr_dr;
+  return (m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR) != 0;
+}
+
+bool Jit64::IsDCacheEnabled() const
+{
+  if (m_compiling_in_background)
+    return m_background_mmu_state.dcache_enabled;
+  return m_ppc_state.m_enable_dcache;
+}
+
 bool Jit64::HandleFunctionHooking(u32 address)
 {
+  // Blocks containing hooks are never compiled in the background, see QueueTierUp.
+  if (m_compiling_in_background)
+    return false;
+
   const auto result = HLE::TryReplaceFunction(m_ppc_symbol_db, address, PowerPC::CoreMode::JIT);
   if (!result)
     return false;
@@ -17,11 +17,17 @@
 // ----------
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 
 #include <rangeset/rangesizeset.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 #include "Common/x64Emitter.h"
 #include "Core/PowerPC/Jit64/JitAsm.h"
 #include "Core/PowerPC/Jit64/RegCache/FPURegCache.h"
@@ -33,6 +39,7 @@
 #include "Core/PowerPC/JitCommon/ConstantPropagation.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/MMU.h"
 
 class HostDisassembler;
 namespace PPCAnalyst
@@ -62,9 +69,24 @@ public:
 
   // Jit!
 
+  // What Jit does when a block doesn't fit into the free near and far code space. Each option
+  // retries with the next one after making room.
+  enum class OnCodeSpaceExhausted
+  {
+    EvictColdBlocks,
+    ClearCache,
+    Fail,
+  };
+
   void Jit(u32 em_address) override;
-  void Jit(u32 em_address, bool clear_cache_and_retry_on_failure);
+  void Jit(u32 em_address, OnCodeSpaceExhausted on_exhausted, bool tier_up = false);
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
+  bool DoBaselineJit(JitBlock* b, u32 nextPC);
+
+  // Recompiles the baseline block at em_address with full optimizations once it has become hot.
+  // With background compilation, the first call only starts compiling the block on another thread,
+  // and the compiled block takes the baseline block's place once its countdown expires again.
+  static void TierUpFromJIT(Jit64& jit, u32 em_address);
 
   void EraseSingleBlock(const JitBlock& block) override;
   std::vector<MemoryStats> GetMemoryStats() const override;
@@ -83,6 +105,14 @@ public:
 
   void FlushRegistersBeforeSlowAccess();
 
+  // Code generation asks these instead of the MMU and the live PowerPC state, so that a
+  // compilation on the tier-up thread uses the state that was captured with its job.
+  bool IsOptimizableRAMAddress(u32 address, u32 access_size) const;
+  u32 IsOptimizableMMIOAccess(u32 address, u32 access_size) const;
+  bool IsOptimizableGatherPipeWrite(u32 address) const;
+  bool IsDataTranslationEnabled() const;
+  bool IsDCacheEnabled() const;
+
   JitCommon::ConstantPropagation& GetConstantPropagation() { return m_constant_propagation; }
 
   JitBlockCache* GetBlockCache() override { return &blocks; }
@@ -275,13 +305,71 @@ public:
 
   void eieio(UGeckoInstruction inst);
 
-private:
+protected:
+  // Register values that the optimizing JIT specializes blocks for. They are captured before
+  // compiling, since a background compilation must not read the live PowerPC state.
+  struct SpeculationValues
+  {
+    std::array<u32, 32> gpr;
+    std::array<u32, 8> gqr;
+    // Addresses that the only linked predecessor of the block is known to leave in GPRs.
+    BitSet32 entry_address_gprs;
+    std::array<u32, 32> entry_addresses;
+  };
+
   void CompileInstruction(PPCAnalyst::CodeOp& op);
 
   bool HandleFunctionHooking(u32 address);
 
+  // Compilation of the optimized version of a baseline block on the tier-up thread. Everything
+  // that the compilation would otherwise read from the live PowerPC state is captured up front.
+  struct TierUpJob
+  {
+    enum class State
+    {
+      Queued,
+      Compiled,
+      Failed,
+    };
+
+    explicit TierUpJob(JitBlock block_) : block(std::move(block_)) {}
+
+    JitBlock block;
+    PPCAnalyst::CodeBlock code_block;
+    PPCAnalyst::CodeBuffer code_buffer;
+    PPCAnalyst::BlockStats st;
+    PPCAnalyst::BlockRegStats gpa;
+    PPCAnalyst::BlockRegStats fpa;
+    u32 next_pc = 0;
+    SpeculationValues speculation_values;
+    PowerPC::MMU::OptimizationState mmu_state;
+    State state = State::Queued;
+  };
+
   void FreeRanges();
+  void MarkCodeRangesUsed(JitBlock* b, u8* near_start, u8* far_start);
   void ResetFreeMemoryRanges();
+  // Erases the blocks that have gone the longest without running until a good part of the near
+  // and far code space is free again. Returns false without erasing anything if no block has to be
+  // erased, or if that would require erasing blocks that have run since the last sweep.
+  bool EvictColdBlocks();
+  u64 GetBlockHeat(const JitBlock& block) const;
+  // Emits code that marks the block as having run since the last sweep, so that blocks that are
+  // still in use don't get evicted.
+  void EmitRanSinceSweep(JitBlock* b);
+  void RefreshTieringConfig();
+  u32 GetExecutionCount(u32 em_address);
+  bool IsBranchUsuallyTaken(u32 address, u32 target);
+  void CaptureSpeculationValues(u32 em_address, SpeculationValues* values);
+  void RecordKnownAddresses(JitBlock::LinkData* link_data) const;
+
+  // Must be called without holding m_codegen_mutex, since it may have to wait for the tier-up
+  // thread.
+  void TierUp(u32 em_address);
+  bool QueueTierUp(JitBlock& baseline_block);
+  void CompileTierUp(u64 job_id);
+  bool PublishTierUp(JitBlock& baseline_block, std::unique_lock<std::recursive_mutex>& lock);
+  void DropTierUpJob(u64 job_id);
 
   void LogGeneratedCode() const;
 
@@ -299,6 +387,35 @@ private:
 
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_near;
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_far;
+  std::size_t m_far_code_size = 0;
+
+  // When running out of code space, cold blocks are evicted until this fraction of the near and
+  // far code space is free. Only if that doesn't make room is the whole cache cleared.
+  static constexpr std::size_t EVICTION_FREE_SPACE_DIVISOR = 4;
+  // Which blocks have run is swept after compiling this many blocks, and before evicting any.
+  static constexpr u32 BLOCKS_PER_SWEEP = 256;
+  u32 m_blocks_compiled_since_sweep = 0;
+
+  // With tiered compilation, blocks are first compiled into cached interpreter callbacks, and
+  // only get compiled by the optimizing JIT after running m_tier_up_threshold times.
+  bool m_tiered_compilation = false;
+  u32 m_tier_up_threshold = 0;
+
+  // With superblocks, the analyzer continues blocks at the target of a conditional branch if the
+  // target has run at least this many times as often as the instruction after the branch.
+  static constexpr u32 SUPERBLOCK_MIN_TAKEN_RATIO = 4;
+
+  // With background compilation, hot blocks are compiled on m_tier_up_thread while the baseline
+  // block keeps running. The jobs are protected by m_codegen_mutex.
+  bool m_tier_up_thread_running = false;
+  bool m_compiling_in_background = false;
+  PowerPC::MMU::OptimizationState m_background_mmu_state;
+  Common::AsyncWorkThread m_tier_up_thread;
+  std::map<u64, std::unique_ptr<TierUpJob>> m_tier_up_jobs;
+  u64 m_next_tier_up_job_id = 1;
+  std::condition_variable_any m_tier_up_job_done;
+
+  SpeculationValues m_speculation_values{};
 
   const bool m_im_here_debug = false;
   const bool m_im_here_log = false;
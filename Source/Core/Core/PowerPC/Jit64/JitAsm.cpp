@@ -219,6 +219,21 @@ void Jit64AsmRoutineManager::Generate()
 
   JMP(dispatcher_no_check);
 
+  tier_up = GetCodePtr();
+
+  // The stack is reset for the same reasons as above.
+  ResetStack(*this);
+
+  ABI_PushRegistersAndAdjustStack({}, 0);
+  MOV(64, R(ABI_PARAM1), Imm64(reinterpret_cast<u64>(&m_jit)));
+  MOV(32, R(ABI_PARAM2), PPCSTATE(pc));
+  ABI_CallFunction(Jit64::TierUpFromJIT);
+  ABI_PopRegistersAndAdjustStack({}, 0);
+
+  MOV(64, R(RMEM), PPCSTATE(mem_ptr));
+
+  JMP(dispatcher_no_check);
+
   SetJumpTarget(bail);
   do_timing = GetCodePtr();
 
@@ -39,6 +39,10 @@ public:
 
   void ResetStack(Gen::X64CodeBlock& emitter);
 
+  // Baseline blocks that have run often enough jump here with PC set to their start address,
+  // to get recompiled with full optimizations.
+  const u8* tier_up = nullptr;
+
 private:
   void Generate();
   void GenerateCommon();
@@ -84,10 +84,11 @@ void Jit64::WriteBranchWatch(u32 origin, u32 destination, UGeckoInstruction inst
     MOV(64, R(ABI_PARAM1), R(reg_a));
   MOV(64, R(ABI_PARAM2), Imm64(Core::FakeBranchWatchCollectionKey{origin, destination}));
   MOV(32, R(ABI_PARAM3), Imm32(inst.hex));
-  ABI_CallFunction(m_ppc_state.msr.IR ? (condition ? &Core::BranchWatch::HitVirtualTrue_fk :
-                                                     &Core::BranchWatch::HitVirtualFalse_fk) :
-                                        (condition ? &Core::BranchWatch::HitPhysicalTrue_fk :
-                                                     &Core::BranchWatch::HitPhysicalFalse_fk));
+  const bool msr_ir = (js.curBlock->feature_flags & FEATURE_FLAG_MSR_IR) != 0;
+  ABI_CallFunction(msr_ir ? (condition ? &Core::BranchWatch::HitVirtualTrue_fk :
+                                         &Core::BranchWatch::HitVirtualFalse_fk) :
+                            (condition ? &Core::BranchWatch::HitPhysicalTrue_fk :
+                                         &Core::BranchWatch::HitPhysicalFalse_fk));
   ABI_PopRegistersAndAdjustStack(caller_save, 0);
 
   FixupBranch branch_out = J(Jump::Near);
@@ -119,8 +120,9 @@ void Jit64::WriteBranchWatchDestInRSCRATCH(u32 origin, UGeckoInstruction inst, X
   MOV(32, R(ABI_PARAM3), R(RSCRATCH));
   MOV(32, R(ABI_PARAM2), Imm32(origin));
   MOV(32, R(ABI_PARAM4), Imm32(inst.hex));
-  ABI_CallFunction(m_ppc_state.msr.IR ? &Core::BranchWatch::HitVirtualTrue :
-                                        &Core::BranchWatch::HitPhysicalTrue);
+  const bool msr_ir = (js.curBlock->feature_flags & FEATURE_FLAG_MSR_IR) != 0;
+  ABI_CallFunction(msr_ir ? &Core::BranchWatch::HitVirtualTrue :
+                            &Core::BranchWatch::HitPhysicalTrue);
   ABI_PopRegistersAndAdjustStack(caller_save, 0);
 
   FixupBranch branch_out = J(Jump::Near);
@@ -231,6 +233,28 @@ void Jit64::bcx(UGeckoInstruction inst)
     return;
   }
 
+  if (js.op->branchFollowed)
+  {
+    // The block continues at the branch target, so the side exit for when the branch isn't taken
+    // goes to far code, keeping the registers of the hot path cached.
+    SwitchToFarCode();
+    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+      SetJumpTarget(pConditionDontBranch);
+    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+      SetJumpTarget(pCTRDontBranch);
+
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+      gpr.Flush();
+      fpr.Flush();
+      WriteExit(js.compilerPC + 4);
+    }
+
+    SwitchToNearCode();
+    return;
+  }
+
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
@@ -10,10 +10,8 @@
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
-#include "Common/Config/Config.h"
 #include "Common/SmallVector.h"
 #include "Common/x64Emitter.h"
-#include "Core/Config/SessionSettings.h"
 #include "Core/PowerPC/Jit64/RegCache/JitRegCache.h"
 #include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
 #include "Core/PowerPC/PPCAnalyst.h"
@@ -366,7 +364,7 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
   // There is one circumstance where the software FMA path does get used: when an input recording
   // is created on a CPU that has FMA instructions and then gets played back on a CPU that doesn't.
   // (Or if the user just really wants to override the setting and knows how to do so.)
-  const bool use_fma = Config::Get(Config::SESSION_USE_FMA);
+  const bool use_fma = m_use_fma;
   const bool software_fma = use_fma && !cpu_info.bFMA;
 
   const int a = inst.FA;
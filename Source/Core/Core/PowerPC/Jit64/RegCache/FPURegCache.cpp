@@ -99,3 +99,9 @@ BitSet32 FPURegCache::CountRegsIn(preg_t preg, u32 lookahead) const
 
   return regs_used;
 }
+
+JitCommon::LinearScanAllocator::RegUsage
+FPURegCache::GetRegUsage(const PPCAnalyst::CodeOp& op) const
+{
+  return {op.fregsIn, op.GetFregsOut(), op.fprInUse};
+}
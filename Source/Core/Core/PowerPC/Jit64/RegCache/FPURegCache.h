@@ -26,4 +26,6 @@ protected:
   std::span<const Gen::X64Reg> GetAllocationOrder() const override;
   BitSet32 GetRegUtilization() const override;
   BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const override;
+  JitCommon::LinearScanAllocator::RegUsage
+  GetRegUsage(const PPCAnalyst::CodeOp& op) const override;
 };
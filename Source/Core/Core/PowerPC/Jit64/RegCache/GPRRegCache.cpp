@@ -132,3 +132,9 @@ BitSet32 GPRRegCache::CountRegsIn(preg_t preg, u32 lookahead) const
 
   return regs_used;
 }
+
+JitCommon::LinearScanAllocator::RegUsage
+GPRRegCache::GetRegUsage(const PPCAnalyst::CodeOp& op) const
+{
+  return {op.regsIn, op.regsOut, op.gprInUse};
+}
@@ -8,6 +8,7 @@
 #include <limits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/BitSet.h"
@@ -17,6 +18,7 @@
 #include "Core/PowerPC/Jit64/Jit.h"
 #include "Core/PowerPC/Jit64/RegCache/CachedReg.h"
 #include "Core/PowerPC/Jit64/RegCache/RCMode.h"
+#include "Core/PowerPC/PPCAnalyst.h"
 
 using namespace Gen;
 using namespace PowerPC;
@@ -242,6 +244,8 @@ void RegCache::Start()
   {
     m_regs[i] = PPCCachedReg{GetDefaultLocation(i)};
   }
+
+  m_planned_ops = nullptr;
 }
 
 void RegCache::SetEmitter(XEmitter* emitter)
@@ -393,6 +397,29 @@ void RegCache::PreloadRegisters(BitSet32 to_preload)
   }
 }
 
+void RegCache::PlanAllocation(std::span<const PPCAnalyst::CodeOp> ops)
+{
+  std::vector<JitCommon::LinearScanAllocator::RegUsage> usages;
+  usages.reserve(ops.size());
+  for (const PPCAnalyst::CodeOp& op : ops)
+    usages.push_back(GetRegUsage(op));
+
+  // Instructions that need scratch registers take them from the same pool, so leave a couple of
+  // registers out of the plan for them.
+  const size_t num_xregs = GetAllocationOrder().size();
+  m_linear_scan.Allocate(usages, num_xregs > 2 ? num_xregs - 2 : 0);
+  m_planned_ops = ops.data();
+}
+
+bool RegCache::IsPlannedInRegister(preg_t preg) const
+{
+  if (!m_planned_ops || m_jit.js.op < m_planned_ops)
+    return false;
+
+  const size_t instruction = static_cast<size_t>(m_jit.js.op - m_planned_ops);
+  return m_linear_scan.GetSlot(preg, instruction) != JitCommon::LinearScanAllocator::NO_SLOT;
+}
+
 BitSet32 RegCache::RegistersInUse() const
 {
   BitSet32 result;
@@ -559,6 +586,11 @@ float RegCache::ScoreRegister(X64Reg xreg) const
     score += 1 + 2 * (5 - log2f(1 + (float)regs_in_count));
   }
 
+  // The allocation plan looks at the whole block rather than just a few instructions ahead, so
+  // bias against clobbering registers that it keeps in a host register here.
+  if (IsPlannedInRegister(preg))
+    score += 2;
+
   return score;
 }
 
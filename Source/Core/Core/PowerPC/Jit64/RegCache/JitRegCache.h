@@ -11,9 +11,14 @@
 
 #include "Common/x64Emitter.h"
 #include "Core/PowerPC/Jit64/RegCache/CachedReg.h"
+#include "Core/PowerPC/JitCommon/LinearScanAllocator.h"
 
 class Jit64;
 enum class RCMode;
+namespace PPCAnalyst
+{
+struct CodeOp;
+}
 
 class RCOpArg;
 class RCX64Reg;
@@ -186,6 +191,11 @@ public:
   void PreloadRegisters(BitSet32 pregs);
   BitSet32 RegistersInUse() const;
 
+  // Runs a linear scan register allocation over the given block ahead of time. Until the next
+  // call to Start, registers that the allocation keeps in a host register are preferably kept
+  // over the ones it spills when a host register has to be freed.
+  void PlanAllocation(std::span<const PPCAnalyst::CodeOp> ops);
+
 protected:
   friend class RCOpArg;
   friend class RCX64Reg;
@@ -201,6 +211,8 @@ protected:
 
   virtual BitSet32 GetRegUtilization() const = 0;
   virtual BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const = 0;
+  virtual JitCommon::LinearScanAllocator::RegUsage
+  GetRegUsage(const PPCAnalyst::CodeOp& op) const = 0;
 
   void FlushX(Gen::X64Reg reg);
   void DiscardRegister(preg_t preg);
@@ -210,6 +222,7 @@ protected:
       IgnoreDiscardedRegisters ignore_discarded_registers = IgnoreDiscardedRegisters::No);
 
   Gen::X64Reg GetFreeXReg();
+  bool IsPlannedInRegister(preg_t preg) const;
 
   int NumFreeRegisters() const;
   float ScoreRegister(Gen::X64Reg xreg) const;
@@ -231,4 +244,7 @@ protected:
   std::array<X64CachedReg, NUM_XREGS> m_xregs;
   std::array<RCConstraint, 32> m_constraints;
   Gen::XEmitter* m_emitter = nullptr;
+
+  JitCommon::LinearScanAllocator m_linear_scan;
+  const PPCAnalyst::CodeOp* m_planned_ops = nullptr;
 };
@@ -64,6 +64,8 @@ void JitBlockCache::DestroyBlock(JitBlock& block)
     m_ranges_to_free_on_next_codegen_near.emplace_back(block.near_begin, block.near_end);
   if (block.far_begin != block.far_end)
     m_ranges_to_free_on_next_codegen_far.emplace_back(block.far_begin, block.far_end);
+  if (block.tier_up_job_id != 0)
+    m_orphaned_tier_up_jobs.push_back(block.tier_up_job_id);
 }
 
 const std::vector<std::pair<u8*, u8*>>& JitBlockCache::GetRangesToFreeNear() const
@@ -76,8 +78,14 @@ const std::vector<std::pair<u8*, u8*>>& JitBlockCache::GetRangesToFreeFar() cons
   return m_ranges_to_free_on_next_codegen_far;
 }
 
+const std::vector<u64>& JitBlockCache::GetOrphanedTierUpJobs() const
+{
+  return m_orphaned_tier_up_jobs;
+}
+
 void JitBlockCache::ClearRangesToFree()
 {
   m_ranges_to_free_on_next_codegen_near.clear();
   m_ranges_to_free_on_next_codegen_far.clear();
+  m_orphaned_tier_up_jobs.clear();
 }
@@ -21,6 +21,9 @@ public:
   const std::vector<std::pair<u8*, u8*>>& GetRangesToFreeNear() const;
   const std::vector<std::pair<u8*, u8*>>& GetRangesToFreeFar() const;
 
+  // Background compilations that were started for blocks that have since been destroyed.
+  const std::vector<u64>& GetOrphanedTierUpJobs() const;
+
   void ClearRangesToFree();
 
 private:
@@ -29,4 +32,5 @@ private:
 
   std::vector<std::pair<u8*, u8*>> m_ranges_to_free_on_next_codegen_near;
   std::vector<std::pair<u8*, u8*>> m_ranges_to_free_on_next_codegen_far;
+  std::vector<u64> m_orphaned_tier_up_jobs;
 };
@@ -7,10 +7,8 @@
 
 #include "Common/Arm64Emitter.h"
 #include "Common/CommonTypes.h"
-#include "Common/Config/Config.h"
 #include "Common/StringUtil.h"
 
-#include "Core/Config/SessionSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -94,7 +92,7 @@ void JitArm64::ps_arith(UGeckoInstruction inst)
   const bool negate_result = (op5 & ~0x1) == 30;
   const bool negate_b = op5 == 28 || op5 == 30;
 
-  const bool nonfused_requested = fma && !Config::Get(Config::SESSION_USE_FMA);
+  const bool nonfused_requested = fma && !m_use_fma;
   const bool error_free_transformation_requested = fma && m_accurate_fmadds;
   const bool round_c = use_c && !js.op->fprIsSingle[c];
 
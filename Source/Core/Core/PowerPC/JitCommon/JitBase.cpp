@@ -14,11 +14,13 @@
 
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/Config/SessionSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
 #include "Core/MemTools.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -57,7 +59,7 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 24> JitBase::JIT_SETTINGS{{
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 28> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -74,12 +76,17 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 24> JitB
     {&JitBase::m_enable_profiling, &Config::MAIN_DEBUG_JIT_ENABLE_PROFILING},
     {&JitBase::m_enable_debugging, &Config::MAIN_ENABLE_DEBUGGING},
     {&JitBase::m_enable_branch_following, &Config::MAIN_JIT_FOLLOW_BRANCH},
+    {&JitBase::m_enable_superblocks, &Config::MAIN_JIT_SUPERBLOCKS},
+    {&JitBase::m_enable_background_compilation, &Config::MAIN_JIT_BACKGROUND_COMPILATION},
+    {&JitBase::m_enable_linear_scan_register_allocation,
+     &Config::MAIN_JIT_LINEAR_SCAN_REGISTER_ALLOCATION},
     {&JitBase::m_enable_float_exceptions, &Config::MAIN_FLOAT_EXCEPTIONS},
     {&JitBase::m_enable_div_by_zero_exceptions, &Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS},
     {&JitBase::m_low_dcbz_hack, &Config::MAIN_LOW_DCBZ_HACK},
     {&JitBase::m_fprf, &Config::MAIN_FPRF},
     {&JitBase::m_accurate_nans, &Config::MAIN_ACCURATE_NANS},
     {&JitBase::m_accurate_fmadds, &Config::MAIN_ACCURATE_FMADDS},
+    {&JitBase::m_use_fma, &Config::SESSION_USE_FMA},
     {&JitBase::m_fastmem_enabled, &Config::MAIN_FASTMEM},
     {&JitBase::m_accurate_cpu_cache_enabled, &Config::MAIN_ACCURATE_CPU_CACHE},
 }};
@@ -92,6 +99,7 @@ const u8* JitBase::Dispatch(JitBase& jit)
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
   jit.Jit(em_address);
+  jit.PrecompileProfiledBlocks();
 }
 
 JitBase::JitBase(Core::System& system)
@@ -286,3 +294,64 @@ bool JitBase::ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op
   else
     return false;
 }
+
+// Keeps the stall of compiling newly loaded code from the block profile short. Whatever is left
+// over gets compiled the next time the JIT is entered.
+constexpr size_t MAX_PRECOMPILED_BLOCKS_PER_CHECK = 256;
+constexpr size_t PRECOMPILE_MIN_FREE_CODE_SPACE = 8 * 1024 * 1024;
+
+void JitBase::PrecompileProfiledBlocks()
+{
+  JitBlockProfile& profile = GetBlockCache()->GetProfile();
+  if (!profile.ShouldCheckPendingBlocks(m_ppc_state.feature_flags))
+    return;
+
+  // Reading instructions ahead of time would disturb the emulated instruction cache, and
+  // debugging wants blocks to be compiled exactly when they are reached.
+  if (m_accurate_cpu_cache_enabled || IsDebuggingEnabled())
+    return;
+
+  // Precompiling must never be the reason for a cache flush.
+  for (const MemoryStats& stats : GetMemoryStats())
+  {
+    if (stats.second.first < PRECOMPILE_MIN_FREE_CODE_SPACE)
+      return;
+  }
+
+  profile.CheckPendingBlocks(
+      m_ppc_state.feature_flags, MAX_PRECOMPILED_BLOCKS_PER_CHECK,
+      [this](const auto& entry) { return TryPrecompileProfiledBlock(entry); });
+}
+
+bool JitBase::TryPrecompileProfiledBlock(const JitBlockProfile::Entry& entry)
+{
+  // Blocks for other modes get their chance once the CPU is in that mode.
+  if (entry.feature_flags != m_ppc_state.feature_flags)
+    return false;
+
+  // Only code mapped by BATs can be looked at without side effects on the emulated TLB.
+  const u32 address = entry.effective_address;
+  if (m_ppc_state.msr.IR &&
+      (m_mmu.GetIBATTable()[address >> PowerPC::BAT_INDEX_SHIFT] & PowerPC::BAT_MAPPED_BIT) == 0)
+  {
+    return false;
+  }
+
+  if (GetBlockCache()->GetBlockFromStartAddress(address, m_ppc_state.feature_flags))
+    return true;
+
+  const PowerPC::TryReadInstResult first_instruction = m_mmu.TryReadInstruction(address);
+  if (!first_instruction.valid || first_instruction.hex != entry.first_instruction)
+    return false;
+
+  // The code is only compiled if it's still exactly what it was when it got recorded.
+  analyzer.Analyze(address, &code_block, &m_code_buffer, m_code_buffer.size());
+  if (code_block.m_memory_exception || code_block.m_num_instructions != entry.instruction_count ||
+      JitBlockProfile::HashCode(m_code_buffer, entry.instruction_count) != entry.code_hash)
+  {
+    return false;
+  }
+
+  Jit(address);
+  return true;
+}
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <map>
+#include <mutex>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
@@ -130,6 +131,7 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    std::unordered_set<u32> noEntryAddressSpeculationAddresses;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -153,12 +155,16 @@ protected:
   bool m_enable_profiling = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
+  bool m_enable_superblocks = false;
+  bool m_enable_background_compilation = false;
+  bool m_enable_linear_scan_register_allocation = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
   bool m_low_dcbz_hack = false;
   bool m_fprf = false;
   bool m_accurate_nans = false;
   bool m_accurate_fmadds = false;
+  bool m_use_fma = false;
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
 
@@ -166,7 +172,7 @@ protected:
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 24> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 28> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh() const;
   void RefreshConfig();
@@ -188,7 +194,7 @@ protected:
 #endif
   }
 
-  bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op) const;
+  bool TryPrecompileProfiledBlock(const JitBlockProfile::Entry& entry);
 
 public:
   explicit JitBase(Core::System& system);
@@ -200,12 +206,17 @@ public:
 
   bool IsProfilingEnabled() const { return m_enable_profiling && m_enable_debugging; }
   bool IsDebuggingEnabled() const { return m_enable_debugging; }
+  bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op) const;
 
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Compiles blocks recorded in the block profile of an earlier session whose code has been
+  // loaded since. Must only be called where Jit could be called.
+  void PrecompileProfiledBlocks();
+
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
   // Memory region name, free size, and fragmentation ratio
@@ -226,6 +237,11 @@ public:
   JitOptions jo{};
   JitState js{};
 
+  // Held while generating code. A JIT that generates code on a background thread reads js and the
+  // block cache while doing so, so this must also be held when modifying those. This includes the
+  // fault handler, which backpatches code and may invalidate the block cache.
+  std::recursive_mutex m_codegen_mutex;
+
   Core::System& m_system;
   PowerPC::PowerPCState& m_ppc_state;
   PowerPC::MMU& m_mmu;
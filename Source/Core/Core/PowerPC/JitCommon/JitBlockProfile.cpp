@@ -0,0 +1,218 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitBlockProfile.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include <xxhash.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+constexpr u32 PROFILE_FILE_MAGIC = 0x4650424A;  // JBPF
+constexpr u32 PROFILE_FILE_VERSION = 1;
+
+// Keeps the file (and the time spent compiling ahead of time on boot) bounded.
+constexpr size_t MAX_ENTRIES = 0x8000;
+
+void JitBlockProfile::Load(const std::string& game_id)
+{
+  m_path = File::GetUserPath(D_CACHE_IDX) + game_id + ".jitprofile";
+  m_recorded.clear();
+  m_recorded_indices.clear();
+  ClearPending();
+
+  File::IOFile file(m_path, "rb");
+  if (!file)
+    return;
+
+  u32 magic;
+  u32 version;
+  if (!file.ReadArray(&magic, 1) || !file.ReadArray(&version, 1) || magic != PROFILE_FILE_MAGIC ||
+      version != PROFILE_FILE_VERSION)
+  {
+    WARN_LOG_FMT(DYNA_REC, "Ignoring JIT block profile {} with an unknown format", m_path);
+    return;
+  }
+
+  const u64 entry_count = (file.GetSize() - file.Tell()) / sizeof(Entry);
+  m_pending.resize(std::min<u64>(entry_count, MAX_ENTRIES));
+  if (!file.ReadArray(m_pending.data(), m_pending.size()))
+  {
+    WARN_LOG_FMT(DYNA_REC, "Failed to read JIT block profile {}", m_path);
+    m_pending.clear();
+    return;
+  }
+
+  // Nothing is known about the code that is already in memory, so every block gets checked once.
+  m_pending_states.assign(m_pending.size(), PendingState::Dirty);
+  m_pending_by_address.resize(m_pending.size());
+  std::iota(m_pending_by_address.begin(), m_pending_by_address.end(), size_t(0));
+  m_dirty = m_pending_by_address;
+  m_dirty_changed = true;
+
+  std::ranges::sort(m_pending_by_address, {},
+                    [this](size_t i) { return m_pending[i].effective_address; });
+  for (const Entry& entry : m_pending)
+    m_max_pending_size = std::max(m_max_pending_size, u64(entry.instruction_count) * 4);
+
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} blocks from JIT block profile {}", m_pending.size(), m_path);
+}
+
+void JitBlockProfile::Save(const std::function<u64(const Entry&)>& get_run_count)
+{
+  if (!IsEnabled())
+    return;
+
+  std::vector<Entry> entries = std::move(m_recorded);
+  for (Entry& entry : entries)
+    entry.run_count = get_run_count(entry);
+
+  // Hottest blocks first, otherwise in the order they were first compiled in.
+  std::ranges::stable_sort(entries, std::ranges::greater{}, &Entry::run_count);
+
+  // Blocks that weren't reached this time are still worth keeping for the next boot.
+  for (const Entry& entry : m_pending)
+  {
+    if (!m_recorded_indices.contains({entry.effective_address, entry.feature_flags}))
+      entries.push_back(entry);
+  }
+
+  if (entries.size() > MAX_ENTRIES)
+    entries.resize(MAX_ENTRIES);
+
+  m_recorded.clear();
+  m_recorded_indices.clear();
+  ClearPending();
+
+  if (entries.empty())
+  {
+    m_path.clear();
+    return;
+  }
+
+  File::IOFile file(m_path, "wb");
+  if (!file || !file.WriteArray(&PROFILE_FILE_MAGIC, 1) ||
+      !file.WriteArray(&PROFILE_FILE_VERSION, 1) ||
+      !file.WriteArray(entries.data(), entries.size()))
+  {
+    WARN_LOG_FMT(DYNA_REC, "Failed to write JIT block profile {}", m_path);
+  }
+
+  m_path.clear();
+}
+
+void JitBlockProfile::RecordBlock(u32 effective_address, u32 feature_flags,
+                                  const PPCAnalyst::CodeBuffer& code_buffer, u32 instruction_count)
+{
+  if (!IsEnabled() || instruction_count == 0)
+    return;
+
+  const Entry entry{effective_address,
+                    feature_flags,
+                    code_buffer[0].inst.hex,
+                    instruction_count,
+                    HashCode(code_buffer, instruction_count),
+                    0};
+
+  const auto [it, inserted] =
+      m_recorded_indices.try_emplace({effective_address, feature_flags}, m_recorded.size());
+  if (inserted)
+  {
+    if (m_recorded.size() < MAX_ENTRIES)
+      m_recorded.push_back(entry);
+    else
+      m_recorded_indices.erase(it);
+  }
+  else
+  {
+    // The code at this address has changed since the block was first compiled.
+    m_recorded[it->second] = entry;
+  }
+}
+
+void JitBlockProfile::OnCodeChanged(u32 effective_address, u32 length)
+{
+  if (m_pending.empty())
+    return;
+
+  const u64 start = effective_address;
+  const u64 end = start + length;
+
+  // Blocks starting before the range can still overlap it.
+  const u64 search_start = start >= m_max_pending_size ? start - m_max_pending_size : 0;
+  auto it = std::ranges::lower_bound(m_pending_by_address, search_start, {},
+                                     [this](size_t i) { return m_pending[i].effective_address; });
+  for (; it != m_pending_by_address.end(); ++it)
+  {
+    const Entry& entry = m_pending[*it];
+    if (entry.effective_address >= end)
+      break;
+
+    if (m_pending_states[*it] == PendingState::Unchanged &&
+        entry.effective_address + u64(entry.instruction_count) * 4 > start)
+    {
+      m_pending_states[*it] = PendingState::Dirty;
+      m_dirty.push_back(*it);
+      m_dirty_changed = true;
+    }
+  }
+}
+
+void JitBlockProfile::CheckPendingBlocks(u32 feature_flags, size_t max_compiles,
+                                         const std::function<bool(const Entry&)>& try_compile)
+{
+  // Hottest blocks first.
+  std::ranges::sort(m_dirty);
+
+  size_t compiles = 0;
+  const auto checked = std::ranges::remove_if(m_dirty, [&](size_t i) {
+    // Blocks for other modes stay dirty until the CPU is in that mode.
+    if (compiles == max_compiles || m_pending[i].feature_flags != feature_flags)
+      return false;
+
+    if (try_compile(m_pending[i]))
+    {
+      m_pending_states[i] = PendingState::Compiled;
+      ++compiles;
+    }
+    else
+    {
+      // Most likely the code hasn't been loaded yet, so wait for it to change again.
+      m_pending_states[i] = PendingState::Unchanged;
+    }
+    return true;
+  });
+  m_dirty.erase(checked.begin(), checked.end());
+
+  m_dirty_changed = compiles == max_compiles;
+  m_checked_feature_flags = feature_flags;
+}
+
+void JitBlockProfile::ClearPending()
+{
+  m_pending.clear();
+  m_pending_states.clear();
+  m_pending_by_address.clear();
+  m_max_pending_size = 0;
+  m_dirty.clear();
+  m_dirty_changed = false;
+  m_checked_feature_flags = 0;
+}
+
+u64 JitBlockProfile::HashCode(const PPCAnalyst::CodeBuffer& code_buffer, u32 instruction_count)
+{
+  XXH3_state_t state;
+  XXH3_64bits_reset(&state);
+  for (u32 i = 0; i < instruction_count; ++i)
+  {
+    const u32 words[2] = {code_buffer[i].address, code_buffer[i].inst.hex};
+    XXH3_64bits_update(&state, words, sizeof(words));
+  }
+  return XXH3_64bits_digest(&state);
+}
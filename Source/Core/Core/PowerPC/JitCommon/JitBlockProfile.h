@@ -0,0 +1,91 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+
+// Records which blocks get compiled while a game is running and stores them in a per-game file,
+// so that the next time the game is booted they can be compiled as soon as their code has been
+// loaded instead of when they are first executed.
+class JitBlockProfile final
+{
+public:
+  struct Entry
+  {
+    u32 effective_address;
+    u32 feature_flags;
+    // Used to cheaply rule out blocks whose code hasn't been loaded yet.
+    u32 first_instruction;
+    u32 instruction_count;
+    // Covers the address and encoding of every instruction in the block.
+    u64 code_hash;
+    // Only known when JIT profiling was enabled, zero otherwise.
+    u64 run_count;
+  };
+
+  bool IsEnabled() const { return !m_path.empty(); }
+
+  // Starts recording for the given game, and loads the blocks recorded for it last time.
+  void Load(const std::string& game_id);
+  // Writes everything recorded so far and stops recording. get_run_count is used to order the
+  // blocks by how hot they are, if that is known.
+  void Save(const std::function<u64(const Entry&)>& get_run_count);
+
+  void RecordBlock(u32 effective_address, u32 feature_flags,
+                   const PPCAnalyst::CodeBuffer& code_buffer, u32 instruction_count);
+
+  // Emulated code may have been loaded or modified in the given range, so the pending blocks
+  // that overlap it should be checked again.
+  void OnCodeChanged(u32 effective_address, u32 length);
+  bool ShouldCheckPendingBlocks(u32 feature_flags) const
+  {
+    return !m_dirty.empty() && (m_dirty_changed || m_checked_feature_flags != feature_flags);
+  }
+
+  // Calls try_compile for each pending block with the given feature flags whose code has changed
+  // since it was last checked, and removes the blocks it returns true for. Stops early (and leaves
+  // the remaining blocks to be checked next time) once try_compile has returned true max_compiles
+  // times.
+  void CheckPendingBlocks(u32 feature_flags, size_t max_compiles,
+                          const std::function<bool(const Entry&)>& try_compile);
+
+  static u64 HashCode(const PPCAnalyst::CodeBuffer& code_buffer, u32 instruction_count);
+
+private:
+  void ClearPending();
+
+  std::string m_path;
+
+  std::vector<Entry> m_recorded;
+  // (effective address, feature flags) -> index into m_recorded
+  std::map<std::pair<u32, u32>, size_t> m_recorded_indices;
+
+  enum class PendingState : u8
+  {
+    Unchanged,
+    Dirty,
+    Compiled,
+  };
+
+  // Blocks loaded from the file, hottest first, and whether they still need to be compiled.
+  std::vector<Entry> m_pending;
+  std::vector<PendingState> m_pending_states;
+  // Indices into m_pending, sorted by address.
+  std::vector<size_t> m_pending_by_address;
+  // The size in bytes of the largest block in m_pending.
+  u64 m_max_pending_size = 0;
+
+  // Indices into m_pending of the blocks whose code has changed since they were last checked.
+  std::vector<size_t> m_dirty;
+  bool m_dirty_changed = false;
+  u32 m_checked_feature_flags = 0;
+};
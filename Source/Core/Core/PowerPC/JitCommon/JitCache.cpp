@@ -8,14 +8,18 @@
 #include <cstring>
 #include <functional>
 #include <map>
+#include <mutex>
 #include <ranges>
 #include <set>
 #include <span>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
@@ -47,6 +51,127 @@ void JitBlock::ProfileData::EndProfiling(ProfileData* data, u32 downcount_amount
   data->time_spent += Clock::now() - data->time_start;
 }
 
+JitPageIndex::JitPageIndex()
+    : m_tables(std::make_unique<std::unique_ptr<PageTable>[]>(TABLE_COUNT)),
+      m_pages_with_code(std::make_unique<u64[]>(PAGE_COUNT / 64))
+{
+}
+
+void JitPageIndex::AddBlock(JitBlock& block)
+{
+  ASSERT(block.page_links.empty());
+
+  u32 page_count = 0;
+  u32 last_page = 0;
+  for (const u32 address : block.physical_addresses)
+  {
+    const u32 page = address >> PAGE_SHIFT;
+    if (page_count == 0 || page != last_page)
+      ++page_count;
+    last_page = page;
+  }
+
+  // The list nodes must not move once they've been linked in. This is the only allocation made
+  // when indexing a block.
+  block.page_links.reserve(page_count);
+
+  for (const u32 address : block.physical_addresses)
+  {
+    const u32 page = address >> PAGE_SHIFT;
+    if (!block.page_links.empty() && block.page_links.back().page == page)
+      continue;
+
+    std::unique_ptr<PageTable>& table = m_tables[page >> TABLE_SHIFT];
+    if (!table)
+      table = std::make_unique<PageTable>();
+
+    JitBlock::PageLink*& head = (*table)[page & TABLE_MASK];
+    JitBlock::PageLink& link = block.page_links.emplace_back(&block, nullptr, head, page);
+    if (head)
+      head->prev = &link;
+    head = &link;
+
+    m_pages_with_code[page / 64] |= u64(1) << (page % 64);
+  }
+}
+
+void JitPageIndex::RemoveBlock(JitBlock& block)
+{
+  for (JitBlock::PageLink& link : block.page_links)
+  {
+    if (link.next)
+      link.next->prev = link.prev;
+
+    if (link.prev)
+    {
+      link.prev->next = link.next;
+    }
+    else
+    {
+      JitBlock::PageLink*& head = (*m_tables[link.page >> TABLE_SHIFT])[link.page & TABLE_MASK];
+      head = link.next;
+      if (!head)
+        m_pages_with_code[link.page / 64] &= ~(u64(1) << (link.page % 64));
+    }
+  }
+
+  block.page_links.clear();
+}
+
+void JitPageIndex::Clear()
+{
+  for (u32 i = 0; i < TABLE_COUNT; ++i)
+  {
+    if (m_tables[i])
+      m_tables[i]->fill(nullptr);
+  }
+  std::fill_n(m_pages_with_code.get(), PAGE_COUNT / 64, 0);
+}
+
+JitExitIndex::JitExitIndex() : m_buckets(std::make_unique<JitBlock::LinkData*[]>(BUCKET_COUNT))
+{
+}
+
+void JitExitIndex::AddBlock(JitBlock& block)
+{
+  for (JitBlock::LinkData& e : block.linkData)
+  {
+    JitBlock::LinkData*& head = m_buckets[GetBucket(e.exitAddress)];
+    e.source = &block;
+    e.prev_in_bucket = nullptr;
+    e.next_in_bucket = head;
+    if (head)
+      head->prev_in_bucket = &e;
+    head = &e;
+  }
+}
+
+void JitExitIndex::RemoveBlock(JitBlock& block)
+{
+  for (JitBlock::LinkData& e : block.linkData)
+  {
+    // Blocks that were compiled without block linking never got added.
+    if (!e.source)
+      continue;
+
+    if (e.next_in_bucket)
+      e.next_in_bucket->prev_in_bucket = e.prev_in_bucket;
+    if (e.prev_in_bucket)
+      e.prev_in_bucket->next_in_bucket = e.next_in_bucket;
+    else
+      m_buckets[GetBucket(e.exitAddress)] = e.next_in_bucket;
+
+    e.source = nullptr;
+    e.prev_in_bucket = nullptr;
+    e.next_in_bucket = nullptr;
+  }
+}
+
+void JitExitIndex::Clear()
+{
+  std::fill_n(m_buckets.get(), BUCKET_COUNT, nullptr);
+}
+
 JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
 {
 }
@@ -64,10 +189,29 @@ void JitBaseBlockCache::Init()
 #endif
 
   Clear();
+
+  const std::string game_id = SConfig::GetInstance().GetGameID();
+  if (Config::Get(Config::MAIN_JIT_BLOCK_PROFILE) && !game_id.empty() && game_id != "00000000")
+    m_profile.Load(game_id);
 }
 
 void JitBaseBlockCache::Shutdown()
 {
+  if (m_profile.IsEnabled())
+  {
+    std::map<std::pair<u32, u32>, u64> run_counts;
+    for (const auto& [physical_address, block] : block_map)
+    {
+      if (block.profile_data)
+        run_counts[{block.effectiveAddress, block.feature_flags}] += block.profile_data->run_count;
+    }
+
+    m_profile.Save([&run_counts](const JitBlockProfile::Entry& entry) -> u64 {
+      const auto it = run_counts.find({entry.effective_address, entry.feature_flags});
+      return it != run_counts.end() ? it->second : 0;
+    });
+  }
+
   Common::JitRegister::Shutdown();
 
   m_entry_points_arena.Release();
@@ -77,19 +221,22 @@ void JitBaseBlockCache::Shutdown()
 // is full and when saving and loading states.
 void JitBaseBlockCache::Clear()
 {
+  std::lock_guard lk(m_jit.m_codegen_mutex);
+
 #if defined(_DEBUG) || defined(DEBUGFAST)
   Core::DisplayMessage("Clearing code cache.", 3000);
 #endif
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
+  m_jit.js.noEntryAddressSpeculationAddresses.clear();
   for (auto& e : block_map)
   {
     DestroyBlock(e.second);
   }
   block_map.clear();
-  links_to.clear();
-  block_range_map.clear();
+  m_exit_index.Clear();
+  m_page_index.Clear();
 
   valid_block.ClearAll();
 
@@ -132,14 +279,23 @@ void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
 
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
-  const u32 physical_address = m_jit.m_mmu.JitCache_TranslateAddress(em_address).address;
-  JitBlock& b = block_map.emplace(physical_address, m_jit.IsProfilingEnabled())->second;
+  return InsertBlock(CreateBlock(em_address));
+}
+
+JitBlock JitBaseBlockCache::CreateBlock(u32 em_address) const
+{
+  JitBlock b(m_jit.IsProfilingEnabled());
   b.effectiveAddress = em_address;
-  b.physicalAddress = physical_address;
+  b.physicalAddress = m_jit.m_mmu.JitCache_TranslateAddress(em_address).address;
   b.feature_flags = m_jit.m_ppc_state.feature_flags;
-  b.linkData.clear();
   b.fast_block_map_index = 0;
-  return &b;
+  return b;
+}
+
+JitBlock* JitBaseBlockCache::InsertBlock(JitBlock&& block)
+{
+  const u32 physical_address = block.physicalAddress;
+  return &block_map.emplace(physical_address, std::move(block))->second;
 }
 
 void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
@@ -157,6 +313,8 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
     m_fast_block_map_fallback[index] = &block;
   }
   block.fast_block_map_index = index;
+  block.sequence_number = m_next_sequence_number++;
+  block.last_run_sweep = m_current_sweep;
 
   block.physical_addresses = code_block.m_physical_addresses;
 
@@ -172,18 +330,15 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
 
   for (u32 addr : block.physical_addresses)
-  {
     valid_block.Set(addr / 32);
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].insert(&block);
-  }
+  m_page_index.AddBlock(block);
+
+  m_profile.RecordBlock(block.effectiveAddress, block.feature_flags, code_buffer,
+                        block.originalSize);
 
   if (block_link)
   {
-    for (const auto& e : block.linkData)
-    {
-      links_to[e.exitAddress].insert(&block);
-    }
-
+    m_exit_index.AddBlock(block);
     LinkBlock(block);
   }
 
@@ -202,6 +357,20 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
 }
 
+void JitBaseBlockCache::ReplaceBlock(const JitBlock& old_block, JitBlock& block, bool block_link,
+                                     const PPCAnalyst::CodeBlock& code_block,
+                                     const PPCAnalyst::CodeBuffer& code_buffer)
+{
+  ASSERT(&old_block != &block);
+  ASSERT(old_block.effectiveAddress == block.effectiveAddress &&
+         old_block.feature_flags == block.feature_flags);
+
+  // Erasing the old block unlinks the exits that lead to it, and finalizing the new block links
+  // them again, this time to the new code.
+  EraseSingleBlock(old_block);
+  FinalizeBlock(block, block_link, code_block, code_buffer);
+}
+
 JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, CPUEmuFeatureFlags feature_flags)
 {
   u32 translated_addr = addr;
@@ -303,6 +472,13 @@ void JitBaseBlockCache::InvalidateICache(u32 initial_address, u32 initial_length
 void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 address, u32 length,
                                                  bool forced)
 {
+  // Blocks must not be destroyed while the tier-up thread is compiling or publishing code.
+  std::lock_guard lk(m_jit.m_codegen_mutex);
+
+  // Newly loaded code is announced through here too, so this is when blocks from the profile
+  // may have become ready to be compiled.
+  m_profile.OnCodeChanged(address, length);
+
   // Optimization for the case of invalidating a single cache line, which is used by the dcb*
   // instructions. If the valid_block bit for that cacheline is not set, we can safely skip
   // the remaining invalidation logic.
@@ -341,6 +517,7 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
         m_jit.js.noSpeculativeConstantsAddresses.erase(i);
+        m_jit.js.noEntryAddressSpeculationAddresses.erase(i);
       }
     }
   }
@@ -348,69 +525,92 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
-  // Iterate over all macro blocks which overlap the given range.
-  auto start = block_range_map.lower_bound(address & BLOCK_RANGE_MAP_MASK);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
+  if (length == 0)
+    return;
+
+  // Iterate over all pages which overlap the given range.
+  const u64 first_page = address >> JitPageIndex::PAGE_SHIFT;
+  const u64 last_page = (u64(address) + length - 1) >> JitPageIndex::PAGE_SHIFT;
+  for (u64 page = first_page; page <= last_page; ++page)
   {
-    // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
-    {
-      JitBlock* block = *iter;
-      if (block->OverlapsPhysicalRange(address, length))
+    m_page_index.ForEachBlock(static_cast<u32>(page), [&](JitBlock& block) {
+      if (!block.OverlapsPhysicalRange(address, length))
+        return;
+
+      // Remove the block from all pages it occupies, then remove the block itself.
+      m_page_index.RemoveBlock(block);
+      DestroyBlock(block);
+      auto block_map_iter = block_map.equal_range(block.physicalAddress);
+      while (block_map_iter.first != block_map_iter.second)
       {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & BLOCK_RANGE_MAP_MASK) != start->first)
-            block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(block);
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
+        if (&block_map_iter.first->second == &block)
         {
-          if (&block_map_iter.first->second == block)
-          {
-            block_map.erase(block_map_iter.first);
-            break;
-          }
-          block_map_iter.first++;
+          block_map.erase(block_map_iter.first);
+          break;
         }
-        iter = start->second.erase(iter);
+        block_map_iter.first++;
       }
-      else
-      {
-        iter++;
-      }
-    }
-
-    // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
+    });
   }
 }
 
 void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
 {
-  const auto equal_range = block_map.equal_range(block.physicalAddress);
-  const auto block_map_iter = std::ranges::find(equal_range.first, equal_range.second, &block,
-                                                [](const auto& kv) { return &kv.second; });
-  if (block_map_iter == equal_range.second) [[unlikely]]
+  const auto block_map_iter = FindInBlockMap(block);
+  if (block_map_iter == block_map.end()) [[unlikely]]
     return;
 
   JitBlock& mutable_block = block_map_iter->second;
 
-  for (const u32 addr : mutable_block.physical_addresses)
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(&mutable_block);
-
+  m_page_index.RemoveBlock(mutable_block);
   DestroyBlock(mutable_block);
   block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
 }
 
+void JitBaseBlockCache::DiscardBlock(const JitBlock& block)
+{
+  const auto block_map_iter = FindInBlockMap(block);
+  if (block_map_iter != block_map.end())
+    block_map.erase(block_map_iter);
+}
+
+std::vector<const JitBlock*>
+JitBaseBlockCache::GetBlocksByHeat(const std::function<u64(const JitBlock&)>& heat) const
+{
+  std::vector<std::tuple<u64, u64, const JitBlock*>> ranked_blocks;
+  ranked_blocks.reserve(block_map.size());
+  for (const auto& [address, block] : block_map)
+    ranked_blocks.emplace_back(heat(block), block.sequence_number, &block);
+  std::ranges::sort(ranked_blocks);
+
+  std::vector<const JitBlock*> result;
+  result.reserve(ranked_blocks.size());
+  for (const auto& ranked_block : ranked_blocks)
+    result.push_back(std::get<const JitBlock*>(ranked_block));
+  return result;
+}
+
+void JitBaseBlockCache::SweepRecentlyRunBlocks()
+{
+  ++m_current_sweep;
+  for (auto& [address, block] : block_map)
+  {
+    if (block.ran_since_sweep && *block.ran_since_sweep != 0)
+    {
+      *block.ran_since_sweep = 0;
+      block.last_run_sweep = m_current_sweep;
+    }
+  }
+}
+
+std::multimap<u32, JitBlock>::iterator JitBaseBlockCache::FindInBlockMap(const JitBlock& block)
+{
+  const auto equal_range = block_map.equal_range(block.physicalAddress);
+  const auto block_map_iter = std::ranges::find(equal_range.first, equal_range.second, &block,
+                                                [](const auto& kv) { return &kv.second; });
+  return block_map_iter == equal_range.second ? block_map.end() : block_map_iter;
+}
+
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
   return valid_block.m_valid_block.get();
@@ -442,18 +642,28 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
   }
 }
 
+const JitBlock::LinkData* JitBaseBlockCache::GetSinglePredecessorExit(
+    u32 em_address, CPUEmuFeatureFlags feature_flags)
+{
+  const JitBlock::LinkData* result = nullptr;
+  bool found_multiple = false;
+  m_exit_index.ForEachExitTo(em_address, [&](const JitBlock::LinkData& e) {
+    if (e.source->feature_flags != feature_flags)
+      return;
+
+    found_multiple |= result != nullptr;
+    result = &e;
+  });
+  return found_multiple ? nullptr : result;
+}
+
 void JitBaseBlockCache::LinkBlock(JitBlock& block)
 {
   LinkBlockExits(block);
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
-    return;
-
-  for (JitBlock* b2 : it->second)
-  {
-    if (block.feature_flags == b2->feature_flags)
-      LinkBlockExits(*b2);
-  }
+  m_exit_index.ForEachExitTo(block.effectiveAddress, [&](const JitBlock::LinkData& e) {
+    if (block.feature_flags == e.source->feature_flags)
+      LinkBlockExits(*e.source);
+  });
 }
 
 void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
@@ -465,23 +675,13 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
   }
 
   // Unlink all exits of other blocks which points to this block
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
-    return;
-  for (JitBlock* sourceBlock : it->second)
-  {
-    if (sourceBlock->feature_flags != block.feature_flags)
-      continue;
+  m_exit_index.ForEachExitTo(block.effectiveAddress, [&](JitBlock::LinkData& e) {
+    if (e.source->feature_flags != block.feature_flags)
+      return;
 
-    for (auto& e : sourceBlock->linkData)
-    {
-      if (e.exitAddress == block.effectiveAddress)
-      {
-        WriteLinkBlock(e, nullptr);
-        e.linkStatus = false;
-      }
-    }
-  }
+    WriteLinkBlock(e, nullptr);
+    e.linkStatus = false;
+  });
 }
 
 void JitBaseBlockCache::DestroyBlock(JitBlock& block)
@@ -504,15 +704,7 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
   UnlinkBlock(block);
 
   // Delete linking addresses
-  for (const auto& e : block.linkData)
-  {
-    auto it = links_to.find(e.exitAddress);
-    if (it == links_to.end())
-      continue;
-    it->second.erase(&block);
-    if (it->second.empty())
-      links_to.erase(it);
-  }
+  m_exit_index.RemoveBlock(block);
 
   // Raise an signal if we are going to call this block again
   WriteDestroyBlock(block);
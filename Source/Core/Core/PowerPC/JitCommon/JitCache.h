@@ -14,11 +14,13 @@
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/JitBlockProfile.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 class JitBase;
@@ -97,9 +99,29 @@ struct JitBlock : public JitBlockData
     u32 exitAddress;
     bool linkStatus;  // is it already linked?
     bool call;
+
+    // GPRs that are known to hold addresses when the exit is taken, and their values. The
+    // destination block can specialize on them if this is the only exit leading to it.
+    std::vector<std::pair<u8, u32>> known_addresses;
+
+    // Maintained by JitExitIndex while the block is linkable.
+    JitBlock* source = nullptr;
+    LinkData* prev_in_bucket = nullptr;
+    LinkData* next_in_bucket = nullptr;
   };
   std::vector<LinkData> linkData;
 
+  // Node of the list of blocks in one physical page, maintained by JitPageIndex.
+  struct PageLink
+  {
+    JitBlock* block;
+    PageLink* prev;
+    PageLink* next;
+    u32 page;
+  };
+  // One entry for every page that physical_addresses touches.
+  std::vector<PageLink> page_links;
+
   // This set stores all physical addresses of all occupied instructions.
   std::set<u32> physical_addresses;
 
@@ -108,6 +130,25 @@ struct JitBlock : public JitBlockData
   std::vector<std::pair<u32, UGeckoInstruction>> original_buffer;
 
   std::unique_ptr<ProfileData> profile_data;
+
+  // Set for blocks that a tiered JIT has compiled with its cheap baseline tier. The generated code
+  // decrements tier_up_countdown on every execution and recompiles the block once it hits zero.
+  bool is_baseline = false;
+  u32 tier_up_countdown = 0;
+  // Identifies the background compilation of the optimized version of a baseline block, if one
+  // has been started.
+  u64 tier_up_job_id = 0;
+
+  // Blocks are numbered in the order in which they were finalized, so that older blocks can be
+  // told apart from younger ones when deciding which blocks to evict.
+  u64 sequence_number = 0;
+
+  // Set to 1 by the generated code whenever the block runs, if the JIT emits code for that, and
+  // cleared by JitBaseBlockCache::SweepRecentlyRunBlocks. It's allocated separately so that its
+  // address stays the same when a block is moved into the cache.
+  std::unique_ptr<u8> ran_since_sweep;
+  // The last sweep that found that the block had run, or the sweep during which it was finalized.
+  u32 last_run_sweep = 0;
 };
 
 typedef void (*CompiledCode)();
@@ -142,6 +183,83 @@ public:
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
 };
 
+// Indexes blocks by the physical pages that their instructions occupy. The blocks of each page are
+// kept in an intrusive list whose nodes are stored in the blocks, so adding a block only allocates
+// its own array of nodes and removing one doesn't allocate at all. Pages that contain any code are
+// tracked in a bitmap, so looking at a page without code is a single bit test.
+class JitPageIndex final
+{
+public:
+  static constexpr u32 PAGE_SHIFT = 12;
+  static constexpr u32 PAGE_COUNT = 1u << (32 - PAGE_SHIFT);
+
+  JitPageIndex();
+
+  void AddBlock(JitBlock& block);
+  void RemoveBlock(JitBlock& block);
+  // Forgets all blocks without touching them.
+  void Clear();
+
+  bool HasCode(u32 page) const { return (m_pages_with_code[page / 64] >> (page % 64)) & 1; }
+
+  // Calls f for every block in the page. f may remove the block it's called with.
+  template <typename F>
+  void ForEachBlock(u32 page, F f)
+  {
+    if (!HasCode(page))
+      return;
+
+    JitBlock::PageLink* link = (*m_tables[page >> TABLE_SHIFT])[page & TABLE_MASK];
+    while (link)
+    {
+      JitBlock::PageLink* next = link->next;
+      f(*link->block);
+      link = next;
+    }
+  }
+
+private:
+  // The list heads are allocated in tables of 1 MiB worth of pages, when first needed.
+  static constexpr u32 TABLE_SHIFT = 8;
+  static constexpr u32 TABLE_MASK = (1u << TABLE_SHIFT) - 1;
+  static constexpr u32 TABLE_COUNT = PAGE_COUNT >> TABLE_SHIFT;
+  using PageTable = std::array<JitBlock::PageLink*, 1u << TABLE_SHIFT>;
+
+  std::unique_ptr<std::unique_ptr<PageTable>[]> m_tables;
+  std::unique_ptr<u64[]> m_pages_with_code;
+};
+
+// Finds the exits of all linkable blocks that jump to a given address. The exits are kept in
+// intrusive lists threaded through JitBlock::LinkData, hashed into a fixed number of buckets by
+// exit address, so adding and removing blocks doesn't allocate.
+class JitExitIndex final
+{
+public:
+  JitExitIndex();
+
+  void AddBlock(JitBlock& block);
+  void RemoveBlock(JitBlock& block);
+  // Forgets all blocks without touching them.
+  void Clear();
+
+  // Calls f for every exit to the address.
+  template <typename F>
+  void ForEachExitTo(u32 address, F f)
+  {
+    for (JitBlock::LinkData* e = m_buckets[GetBucket(address)]; e; e = e->next_in_bucket)
+    {
+      if (e->exitAddress == address)
+        f(*e);
+    }
+  }
+
+private:
+  static constexpr u32 BUCKET_COUNT = 0x10000;
+  static u32 GetBucket(u32 address) { return (address >> 2) & (BUCKET_COUNT - 1); }
+
+  std::unique_ptr<JitBlock::LinkData*[]> m_buckets;
+};
+
 class JitBaseBlockCache
 {
 public:
@@ -167,8 +285,23 @@ public:
   std::size_t GetBlockCount() const { return block_map.size(); }
 
   JitBlock* AllocateBlock(u32 em_address);
+  // Creates a block for the current feature flags without adding it to the cache, so that it can
+  // be compiled on another thread. InsertBlock adds it to the cache before it gets finalized.
+  JitBlock CreateBlock(u32 em_address) const;
+  JitBlock* InsertBlock(JitBlock&& block);
+
+  // Returns the exit of a linkable block that leads to the given block, or nullptr if there are
+  // no such exits or more than one.
+  const JitBlock::LinkData* GetSinglePredecessorExit(u32 em_address,
+                                                      CPUEmuFeatureFlags feature_flags);
   void FinalizeBlock(JitBlock& block, bool block_link, const PPCAnalyst::CodeBlock& code_block,
                      const PPCAnalyst::CodeBuffer& code_buffer);
+  // Finalizes block as the successor of old_block, which must have been compiled for the same
+  // address and feature flags. old_block is erased, and exits of other blocks that were linked to
+  // it get linked to block instead.
+  void ReplaceBlock(const JitBlock& old_block, JitBlock& block, bool block_link,
+                    const PPCAnalyst::CodeBlock& code_block,
+                    const PPCAnalyst::CodeBuffer& code_buffer);
 
   // Look for the block in the slow but accurate way.
   // This function shall be used if FastLookupIndexForAddress() failed.
@@ -185,9 +318,24 @@ public:
   void InvalidateICacheLine(u32 address);
   void ErasePhysicalRange(u32 address, u32 length);
   void EraseSingleBlock(const JitBlock& block);
+  // Removes a block that was allocated but never finalized, e.g. because generating its code
+  // failed. Unlike EraseSingleBlock, this doesn't touch the code the block was being written to.
+  void DiscardBlock(const JitBlock& block);
+
+  // Returns all blocks, ordered from the least to the most valuable one to keep as rated by heat.
+  // Blocks that are equally hot are ordered from the oldest to the youngest one.
+  std::vector<const JitBlock*>
+  GetBlocksByHeat(const std::function<u64(const JitBlock&)>& heat) const;
+
+  // Starts a new sweep and records it as the last run of every block that has run since the
+  // previous one.
+  void SweepRecentlyRunBlocks();
+  u32 GetCurrentSweep() const { return m_current_sweep; }
 
   u32* GetBlockBitSet() const;
 
+  JitBlockProfile& GetProfile() { return m_profile; }
+
 protected:
   virtual void DestroyBlock(JitBlock& block);
 
@@ -203,23 +351,22 @@ private:
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
 
   JitBlock* MoveBlockIntoFastCache(u32 em_address, CPUEmuFeatureFlags feature_flags);
+  std::multimap<u32, JitBlock>::iterator FindInBlockMap(const JitBlock& block);
 
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address, u32 msr);
 
-  // links_to hold all exit points of all valid blocks in a reverse way.
-  // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  // Holds all exit points of all linkable blocks in a reverse way.
+  // It is used to query all blocks which link to an address.
+  JitExitIndex m_exit_index;
 
   // Map indexed by the physical address of the entry point.
   // This is used to query the block based on the current PC in a slow way.
   std::multimap<u32, JitBlock> block_map;  // start_addr -> block
 
-  // Range of overlapping code indexed by a masked physical address.
-  // This is used for invalidation of memory regions. The range is grouped
-  // in macro blocks of each 0x100 bytes.
-  static constexpr u32 BLOCK_RANGE_MAP_MASK = ~(0x100 - 1);
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  // Blocks indexed by the physical pages of code they overlap.
+  // This is used for invalidation of memory regions.
+  JitPageIndex m_page_index;
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
@@ -235,4 +382,10 @@ private:
   // in case the shm memory region couldn't be allocated.
   std::array<JitBlock*, FAST_BLOCK_MAP_FALLBACK_ELEMENTS>
       m_fast_block_map_fallback{};  // start_addr & mask -> number
+
+  // Blocks compiled this session, and blocks from the last session yet to be compiled.
+  JitBlockProfile m_profile;
+
+  u64 m_next_sequence_number = 0;
+  u32 m_current_sweep = 0;
 };
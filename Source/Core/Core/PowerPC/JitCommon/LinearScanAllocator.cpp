@@ -0,0 +1,158 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/LinearScanAllocator.h"
+
+#include <algorithm>
+
+namespace JitCommon
+{
+void LinearScanAllocator::Allocate(std::span<const RegUsage> usages, size_t num_slots)
+{
+  BuildLiveRanges(usages);
+  AssignSlots(std::min<size_t>(num_slots, 32));
+
+  std::array<s8, 32> no_slots;
+  no_slots.fill(NO_SLOT);
+  m_slots.assign(usages.size(), no_slots);
+
+  for (const LiveRange& range : m_live_ranges)
+  {
+    if (range.slot == NO_SLOT)
+      continue;
+
+    for (u32 i = range.start; i <= range.end; ++i)
+      m_slots[i][range.reg] = range.slot;
+  }
+}
+
+s8 LinearScanAllocator::GetSlot(size_t reg, size_t instruction) const
+{
+  if (instruction >= m_slots.size())
+    return NO_SLOT;
+
+  return m_slots[instruction][reg];
+}
+
+void LinearScanAllocator::BuildLiveRanges(std::span<const RegUsage> usages)
+{
+  m_live_ranges.clear();
+
+  // For registers holding a value that is accessed again, the range that starts at the last
+  // access of that value. Its end is filled in once the next access is found.
+  std::array<size_t, 32> open_ranges;
+  BitSet32 open_regs;
+
+  for (u32 i = 0; i < usages.size(); ++i)
+  {
+    const RegUsage& usage = usages[i];
+
+    for (const int reg : usage.regs_in | usage.regs_out)
+    {
+      // Overwriting a register without reading it first starts a new value.
+      const bool continues_range = open_regs[reg] && usage.regs_in[reg];
+      if (continues_range)
+        m_live_ranges[open_ranges[reg]].end = i;
+
+      if (usage.regs_in_use[reg])
+      {
+        open_ranges[reg] = m_live_ranges.size();
+        m_live_ranges.push_back({i, i, static_cast<u8>(reg), NO_SLOT});
+      }
+      else if (!continues_range)
+      {
+        m_live_ranges.push_back({i, i, static_cast<u8>(reg), NO_SLOT});
+      }
+    }
+
+    open_regs = (open_regs | usage.regs_in | usage.regs_out) & usage.regs_in_use;
+  }
+
+  // Ranges are created in order of their start, so there's no need to sort them.
+}
+
+void LinearScanAllocator::AssignSlots(size_t num_slots)
+{
+  m_spilled_live_range_count = 0;
+
+  BitSet32 all_slots;
+  for (size_t slot = 0; slot < num_slots; ++slot)
+    all_slots[slot] = true;
+
+  // The range each slot is assigned to, for the slots in used_slots, along with the end and
+  // register of that range so that they can be checked without branching.
+  std::array<size_t, 32> slot_ranges;
+  std::array<u32, 32> slot_ends{};
+  std::array<u8, 32> slot_regs{};
+  BitSet32 used_slots;
+
+  // The slot that held each register before the range that is being assigned, if any.
+  std::array<s8, 32> previous_slots;
+  previous_slots.fill(NO_SLOT);
+
+  for (size_t index = 0; index < m_live_ranges.size(); ++index)
+  {
+    LiveRange& range = m_live_ranges[index];
+
+    // A range that ends at the instruction where this one starts is still needed by that
+    // instruction, so it can't give up its slot yet. The exception is the range that holds the
+    // same value up to that instruction, which this one takes over from.
+    u32 ended_slots = 0;
+    for (size_t slot = 0; slot < num_slots; ++slot)
+    {
+      const bool ended = slot_ends[slot] < range.start || slot_regs[slot] == range.reg;
+      ended_slots |= u32{ended} << slot;
+    }
+    used_slots &= ~BitSet32(ended_slots);
+
+    // Keep values in the same slot from one range to the next where possible, so that they don't
+    // have to be moved between registers.
+    const BitSet32 free_slots = all_slots & ~used_slots;
+    const s8 previous_slot = previous_slots[range.reg];
+    if (previous_slot != NO_SLOT && free_slots[previous_slot])
+    {
+      range.slot = previous_slot;
+    }
+    else if (free_slots.Count() != 0)
+    {
+      range.slot = static_cast<s8>(*free_slots.begin());
+    }
+    else
+    {
+      ++m_spilled_live_range_count;
+
+      // Spill whichever range is going to occupy its slot for the longest. Since ranges only
+      // cover the instructions between two accesses of a value, this spills the value that is
+      // accessed again the furthest in the future.
+      s8 spilled_slot = NO_SLOT;
+      u32 spilled_end = range.end;
+      for (const int slot : used_slots)
+      {
+        if (slot_ends[slot] > spilled_end)
+        {
+          spilled_slot = static_cast<s8>(slot);
+          spilled_end = slot_ends[slot];
+        }
+      }
+
+      if (spilled_slot != NO_SLOT)
+      {
+        LiveRange& spilled = m_live_ranges[slot_ranges[spilled_slot]];
+        spilled.slot = NO_SLOT;
+        previous_slots[spilled.reg] = NO_SLOT;
+      }
+
+      range.slot = spilled_slot;
+      previous_slots[range.reg] = spilled_slot;
+      if (spilled_slot == NO_SLOT)
+        continue;
+    }
+
+    used_slots[range.slot] = true;
+    slot_ranges[range.slot] = index;
+    slot_ends[range.slot] = range.end;
+    slot_regs[range.slot] = range.reg;
+    previous_slots[range.reg] = range.slot;
+  }
+}
+}  // namespace JitCommon
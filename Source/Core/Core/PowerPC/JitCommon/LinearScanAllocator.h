@@ -0,0 +1,65 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
+
+namespace JitCommon
+{
+// Assigns host registers to the guest registers of a block before any code for it is generated.
+//
+// The instructions from one access of a value in a guest register to the next access of that
+// value form a live range. Live ranges are handed out a fixed number of host register slots in
+// order of where they start, and when more ranges are live at once than there are slots, the
+// range that ends last is spilled, which is the value that is accessed again the furthest in the
+// future. Unlike register cache heuristics that only look a few instructions ahead, this takes
+// the whole block into account when deciding which values to keep in host registers.
+class LinearScanAllocator final
+{
+public:
+  struct RegUsage
+  {
+    BitSet32 regs_in;
+    BitSet32 regs_out;
+    // Registers that are accessed again by a later instruction in the block.
+    BitSet32 regs_in_use;
+  };
+
+  static constexpr s8 NO_SLOT = -1;
+
+  void Allocate(std::span<const RegUsage> usages, size_t num_slots);
+
+  // Returns the slot assigned to the live range of reg that covers the given instruction, or
+  // NO_SLOT if reg isn't live there or its live range was spilled.
+  s8 GetSlot(size_t reg, size_t instruction) const;
+
+  size_t GetLiveRangeCount() const { return m_live_ranges.size(); }
+  size_t GetSpilledLiveRangeCount() const { return m_spilled_live_range_count; }
+
+private:
+  struct LiveRange
+  {
+    u32 start;
+    u32 end;
+    u8 reg;
+    s8 slot;
+  };
+
+  void BuildLiveRanges(std::span<const RegUsage> usages);
+  void AssignSlots(size_t num_slots);
+
+  std::vector<std::array<s8, 32>> m_slots;
+
+  // Kept around between blocks to avoid reallocating it for every block.
+  std::vector<LiveRange> m_live_ranges;
+
+  size_t m_spilled_live_range_count = 0;
+};
+}  // namespace JitCommon
@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/JitInterface.h"
 
+#include <mutex>
 #include <string>
 #include <unordered_set>
 
@@ -301,6 +302,8 @@ void JitInterface::CompileExceptionCheck(ExceptionType type)
   if (!m_jit)
     return;
 
+  std::lock_guard lk(m_jit->m_codegen_mutex);
+
   std::unordered_set<u32>* exception_addresses = nullptr;
 
   switch (type)
@@ -314,6 +317,9 @@ void JitInterface::CompileExceptionCheck(ExceptionType type)
   case ExceptionType::SpeculativeConstants:
     exception_addresses = &m_jit->js.noSpeculativeConstantsAddresses;
     break;
+  case ExceptionType::EntryAddressSpeculation:
+    exception_addresses = &m_jit->js.noEntryAddressSpeculationAddresses;
+    break;
   }
 
   auto& ppc_state = m_system.GetPPCState();
@@ -811,11 +811,26 @@ bool MMU::IsOptimizableRAMAddress(const u32 address, const u32 access_size) cons
   if (m_ppc_state.m_enable_dcache)
     return false;
 
+  return IsOptimizableRAMAddress(m_dbat_table, address, access_size);
+}
+
+bool MMU::IsOptimizableRAMAddress(const OptimizationState& state, const u32 address,
+                                  const u32 access_size) const
+{
+  if (state.memchecks_active || !state.msr_dr || state.dcache_enabled)
+    return false;
+
+  return IsOptimizableRAMAddress(*state.dbat_table, address, access_size);
+}
+
+bool MMU::IsOptimizableRAMAddress(const BatTable& dbat_table, const u32 address,
+                                  const u32 access_size)
+{
   // We store whether an access can be optimized to an unchecked access
   // in dbat_table.
   const u32 last_byte_address = address + (access_size >> 3) - 1;
-  const u32 bat_result_1 = m_dbat_table[address >> BAT_INDEX_SHIFT];
-  const u32 bat_result_2 = m_dbat_table[last_byte_address >> BAT_INDEX_SHIFT];
+  const u32 bat_result_1 = dbat_table[address >> BAT_INDEX_SHIFT];
+  const u32 bat_result_2 = dbat_table[last_byte_address >> BAT_INDEX_SHIFT];
   return (bat_result_1 & bat_result_2 & BAT_PHYSICAL_BIT) != 0;
 }
 
@@ -1102,11 +1117,25 @@ u32 MMU::IsOptimizableMMIOAccess(u32 address, u32 access_size) const
   if (m_ppc_state.m_enable_dcache)
     return 0;
 
+  return IsOptimizableMMIOAccess(m_dbat_table, address, access_size);
+}
+
+u32 MMU::IsOptimizableMMIOAccess(const OptimizationState& state, u32 address,
+                                 u32 access_size) const
+{
+  if (state.memchecks_active || !state.msr_dr || state.dcache_enabled)
+    return 0;
+
+  return IsOptimizableMMIOAccess(*state.dbat_table, address, access_size);
+}
+
+u32 MMU::IsOptimizableMMIOAccess(const BatTable& dbat_table, u32 address, u32 access_size) const
+{
   // Translate address
   // If we also optimize for TLB mappings, we'd have to clear the
   // JitCache on each TLB invalidation.
   bool wi = false;
-  if (!TranslateBatAddress(m_dbat_table, &address, &wi))
+  if (!TranslateBatAddress(dbat_table, &address, &wi))
     return 0;
 
   // Check whether the address is an aligned address of an MMIO register.
@@ -1125,17 +1154,43 @@ bool MMU::IsOptimizableGatherPipeWrite(u32 address) const
   if (!m_ppc_state.msr.DR)
     return false;
 
+  return IsOptimizableGatherPipeWrite(m_dbat_table, address);
+}
+
+bool MMU::IsOptimizableGatherPipeWrite(const OptimizationState& state, u32 address) const
+{
+  if (state.memchecks_active || !state.msr_dr)
+    return false;
+
+  return IsOptimizableGatherPipeWrite(*state.dbat_table, address);
+}
+
+bool MMU::IsOptimizableGatherPipeWrite(const BatTable& dbat_table, u32 address)
+{
   // Translate address, only check BAT mapping.
   // If we also optimize for TLB mappings, we'd have to clear the
   // JitCache on each TLB invalidation.
   bool wi = false;
-  if (!TranslateBatAddress(m_dbat_table, &address, &wi))
+  if (!TranslateBatAddress(dbat_table, &address, &wi))
     return false;
 
   // Check whether the translated address equals the address in WPAR.
   return address == GPFifo::GATHER_PIPE_PHYSICAL_ADDRESS;
 }
 
+MMU::OptimizationState MMU::GetOptimizationState()
+{
+  if (!m_dbat_table_copy)
+    m_dbat_table_copy = std::make_shared<const BatTable>(m_dbat_table);
+
+  OptimizationState state;
+  state.memchecks_active = m_power_pc.GetMemChecks().HasAny();
+  state.msr_dr = m_ppc_state.msr.DR;
+  state.dcache_enabled = m_ppc_state.m_enable_dcache;
+  state.dbat_table = m_dbat_table_copy;
+  return state;
+}
+
 TranslateResult MMU::JitCache_TranslateAddress(u32 address)
 {
   if (!m_ppc_state.msr.IR)
@@ -1520,6 +1575,7 @@ void MMU::UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr)
 
 void MMU::DBATUpdated()
 {
+  m_dbat_table_copy.reset();
   m_dbat_table = {};
   UpdateBATs(m_dbat_table, SPR_DBAT0U);
   bool extended_bats = m_system.IsWii() && HID4(m_ppc_state).SBE;
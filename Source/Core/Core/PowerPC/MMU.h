@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -248,6 +249,22 @@ public:
   u32 IsOptimizableMMIOAccess(u32 address, u32 access_size) const;
   bool IsOptimizableGatherPipeWrite(u32 address) const;
 
+  // Everything the IsOptimizable*() functions depend on. A JIT that generates code on another
+  // thread takes a copy of this on the CPU thread and asks the overloads below instead, since the
+  // CPU thread keeps changing the live state while the code is being generated.
+  struct OptimizationState
+  {
+    bool memchecks_active = false;
+    bool msr_dr = false;
+    bool dcache_enabled = false;
+    std::shared_ptr<const BatTable> dbat_table;
+  };
+  OptimizationState GetOptimizationState();
+
+  bool IsOptimizableRAMAddress(const OptimizationState& state, u32 address, u32 access_size) const;
+  u32 IsOptimizableMMIOAccess(const OptimizationState& state, u32 address, u32 access_size) const;
+  bool IsOptimizableGatherPipeWrite(const OptimizationState& state, u32 address) const;
+
   TranslateResult JitCache_TranslateAddress(u32 address);
 
   std::optional<u32> GetTranslatedAddress(u32 address);
@@ -312,6 +329,10 @@ private:
   bool IsEffectiveRAMAddress(u32 address);
   bool IsPhysicalRAMAddress(u32 address) const;
 
+  static bool IsOptimizableRAMAddress(const BatTable& dbat_table, u32 address, u32 access_size);
+  u32 IsOptimizableMMIOAccess(const BatTable& dbat_table, u32 address, u32 access_size) const;
+  static bool IsOptimizableGatherPipeWrite(const BatTable& dbat_table, u32 address);
+
   Core::System& m_system;
   Memory::MemoryManager& m_memory;
   PowerPC::PowerPCManager& m_power_pc;
@@ -319,6 +340,8 @@ private:
 
   BatTable m_ibat_table;
   BatTable m_dbat_table;
+  // Shared by the OptimizationStates taken since the DBATs were last updated.
+  std::shared_ptr<const BatTable> m_dbat_table_copy;
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
@@ -797,6 +797,22 @@ static bool CanCauseGatherPipeInterruptCheck(const CodeOp& op)
          op.opinfo->type == OpType::StorePS;
 }
 
+bool PPCAnalyzer::ShouldFollowConditionalBranch(const CodeOp& op, u32 num_follows) const
+{
+  if (!m_enable_branch_following || !HasOption(OPTION_FOLLOW_HOT_BRANCHES) ||
+      !HasOption(OPTION_BRANCH_FOLLOW) || !m_branch_predictor)
+  {
+    return false;
+  }
+
+  // Only bcx has a destination that is known ahead of time. Following conditional calls would
+  // require faking the BLR stack, and following backward branches would unroll loops.
+  if (op.inst.OPCD != 16 || op.inst.LK || op.branchTo <= op.address)
+    return false;
+
+  return num_follows < BRANCH_FOLLOWING_THRESHOLD && m_branch_predictor(op.address, op.branchTo);
+}
+
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
                          std::size_t block_size) const
 {
@@ -939,12 +955,19 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       }
     }
 
+    if (conditional_continue && ShouldFollowConditionalBranch(code[i], numFollows))
+    {
+      code[i].branchFollowed = true;
+      follow = true;
+      found_call = false;
+    }
+
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
 
     if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
     {
-      // Follow the unconditional branch.
+      // Follow the unconditional (or usually taken) branch.
       numFollows++;
       address = code[i].branchTo;
     }
@@ -5,7 +5,9 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -51,6 +53,8 @@ struct CodeOp  // 16B
   bool canCauseException = false;
   bool skipLRStack = false;
   bool skip = false;  // followed BL-s for example
+  // The block continues at the target of this conditional branch rather than after it.
+  bool branchFollowed = false;
   BitSet8 crInUse;
   BitSet8 crDiscardable;
   // which registers are still needed after this instruction in this block
@@ -171,8 +175,17 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Continue the block at the target of conditional branches that the branch predictor
+    // reports as usually taken, forming superblocks out of hot paths. The JIT has to leave the
+    // block when such a branch isn't taken.
+    // Requires OPTION_CONDITIONAL_CONTINUE and OPTION_BRANCH_FOLLOW.
+    OPTION_FOLLOW_HOT_BRANCHES = (1 << 7),
   };
 
+  // Returns whether the conditional branch at address to target is usually taken.
+  using BranchPredictor = std::function<bool(u32 address, u32 target)>;
+
   // Option setting/getting
   void SetOption(AnalystOption option) { m_options |= option; }
   void ClearOption(AnalystOption option) { m_options &= ~(option); }
@@ -181,6 +194,7 @@ public:
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
+  void SetBranchPredictor(BranchPredictor predictor) { m_branch_predictor = std::move(predictor); }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
 
 private:
@@ -197,6 +211,7 @@ private:
   void ReorderInstructions(u32 instructions, CodeOp* code) const;
   void SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo) const;
   bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const;
+  bool ShouldFollowConditionalBranch(const CodeOp& op, u32 num_follows) const;
 
   // Options
   u32 m_options = 0;
@@ -205,6 +220,7 @@ private:
   bool m_enable_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
+  BranchPredictor m_branch_predictor;
 };
 
 void FindFunctions(const Core::CPUThreadGuard& guard, u32 startAddr, u32 endAddr,
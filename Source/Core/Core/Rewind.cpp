@@ -0,0 +1,254 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Rewind.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+#include <lz4.h>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Common/ScopeGuard.h"
+#include "Common/WorkQueueThread.h"
+
+#include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/SystemTimers.h"
+#include "Core/NetPlayProto.h"
+#include "Core/State.h"
+#include "Core/System.h"
+
+namespace Rewind
+{
+namespace
+{
+struct Capture
+{
+  // Location of the compressed state within s_ring
+  size_t offset;
+  size_t compressed_size;
+  size_t size;
+};
+}  // namespace
+
+static CoreTiming::EventType* s_event_type_capture = nullptr;
+static bool s_enabled = false;
+static u32 s_interval_ms = 0;
+
+// Set while a capture is being taken or compressed, so that captures never pile up.
+// Only one capture uses the capture scratch buffers at a time because of this.
+static std::atomic<bool> s_capture_in_progress = false;
+static Common::UniqueBuffer<u8> s_capture_buffer;
+static Common::UniqueBuffer<u8> s_compressed_buffer;
+
+// Loading a state yields to the host, which may try to step back again in the meantime.
+static std::atomic<bool> s_step_in_progress = false;
+static Common::UniqueBuffer<u8> s_load_buffer;
+
+// Protects everything below.
+static std::mutex s_mutex;
+
+// Compressed captures are stored back to back in this fixed-size buffer, wrapping around at the
+// end. Oldest captures are evicted to make room for new ones.
+static Common::UniqueBuffer<u8> s_ring;
+static size_t s_ring_head = 0;
+static std::deque<Capture> s_captures;
+
+static Common::AsyncWorkThread s_compress_thread;
+
+static void ScheduleCapture(Core::System& system, s64 cycles_late)
+{
+  const s64 interval_cycles =
+      s64(system.GetSystemTimers().GetTicksPerSecond()) * s_interval_ms / 1000;
+  system.GetCoreTiming().ScheduleEvent(interval_cycles - cycles_late, s_event_type_capture);
+}
+
+// Evicts the oldest captures until there is room for the given size, and returns the offset
+// within s_ring at which it can be stored.
+static size_t AllocateCapture(size_t size)
+{
+  size_t offset = s_ring_head;
+  if (offset + size > s_ring.size())
+  {
+    // Everything between the head and the end of the ring is older than what is at its start.
+    while (!s_captures.empty() && s_captures.front().offset >= offset)
+      s_captures.pop_front();
+    offset = 0;
+  }
+
+  while (!s_captures.empty() && s_captures.front().offset >= offset &&
+         s_captures.front().offset < offset + size)
+  {
+    s_captures.pop_front();
+  }
+
+  return offset;
+}
+
+static void CompressCapture(size_t size)
+{
+  if (size > LZ4_MAX_INPUT_SIZE)
+  {
+    WARN_LOG_FMT(CORE, "Rewind: State of {} bytes is too large to be captured", size);
+    return;
+  }
+
+  const size_t bound = LZ4_compressBound(static_cast<int>(size));
+  if (bound > s_compressed_buffer.size())
+    s_compressed_buffer.reset(bound);
+
+  const int compressed_size = LZ4_compress_default(
+      reinterpret_cast<const char*>(s_capture_buffer.data()),
+      reinterpret_cast<char*>(s_compressed_buffer.data()), static_cast<int>(size),
+      static_cast<int>(s_compressed_buffer.size()));
+  if (compressed_size <= 0)
+  {
+    WARN_LOG_FMT(CORE, "Rewind: Failed to compress state");
+    return;
+  }
+
+  std::lock_guard lk(s_mutex);
+  if (static_cast<size_t>(compressed_size) > s_ring.size())
+  {
+    WARN_LOG_FMT(CORE, "Rewind: Compressed state of {} bytes does not fit into the buffer",
+                 compressed_size);
+    return;
+  }
+
+  const size_t offset = AllocateCapture(compressed_size);
+  std::copy_n(s_compressed_buffer.data(), compressed_size, s_ring.data() + offset);
+  s_ring_head = offset + compressed_size;
+  s_captures.push_back({offset, static_cast<size_t>(compressed_size), size});
+}
+
+static void CaptureState(Core::System& system)
+{
+  if (NetPlay::IsNetPlayRunning() || AchievementManager::GetInstance().IsHardcoreModeActive())
+  {
+    s_capture_in_progress = false;
+    return;
+  }
+
+  const size_t size = State::SaveToBuffer(system, s_capture_buffer);
+  if (size == 0)
+  {
+    s_capture_in_progress = false;
+    return;
+  }
+
+  s_compress_thread.Push([size] {
+    CompressCapture(size);
+    s_capture_in_progress = false;
+  });
+}
+
+static void CaptureCallback(Core::System& system, u64 userdata, s64 cycles_late)
+{
+  if (!s_enabled)
+    return;
+
+  ScheduleCapture(system, cycles_late);
+
+  // States can't be taken from within CoreTiming, so let the host thread request one.
+  if (!s_capture_in_progress.exchange(true))
+    Core::QueueHostJob(CaptureState);
+}
+
+void Init(Core::System& system)
+{
+  s_event_type_capture = system.GetCoreTiming().RegisterEvent("RewindCapture", CaptureCallback);
+
+  s_enabled = Config::Get(Config::MAIN_REWIND_ENABLE);
+  s_interval_ms = std::max(Config::Get(Config::MAIN_REWIND_INTERVAL), 1u);
+  if (!s_enabled)
+    return;
+
+  {
+    std::lock_guard lk(s_mutex);
+    s_ring.reset(size_t(Config::Get(Config::MAIN_REWIND_BUFFER_SIZE)) * 1024 * 1024);
+    s_ring_head = 0;
+    s_captures.clear();
+  }
+
+  s_capture_in_progress = false;
+  s_compress_thread.Reset("Rewind Compression");
+  ScheduleCapture(system, 0);
+}
+
+void Shutdown()
+{
+  s_compress_thread.Shutdown();
+  s_capture_in_progress = false;
+  s_enabled = false;
+
+  std::lock_guard lk(s_mutex);
+  s_ring.reset();
+  s_ring_head = 0;
+  s_captures.clear();
+  s_capture_buffer.reset();
+  s_compressed_buffer.reset();
+  s_load_buffer.reset();
+}
+
+void OnStateLoaded(Core::System& system)
+{
+  if (!s_enabled)
+    return;
+
+  auto& core_timing = system.GetCoreTiming();
+  core_timing.RemoveEvent(s_event_type_capture);
+  ScheduleCapture(system, 0);
+}
+
+bool StepBack(Core::System& system)
+{
+  if (!s_enabled)
+    return false;
+
+  if (s_step_in_progress.exchange(true))
+    return false;
+  Common::ScopeGuard step_guard([] { s_step_in_progress = false; });
+
+  // Make sure the most recent capture has made it into the ring.
+  s_compress_thread.WaitForCompletion();
+
+  {
+    std::lock_guard lk(s_mutex);
+    if (s_captures.empty())
+      return false;
+
+    const Capture capture = s_captures.back();
+    s_captures.pop_back();
+    s_ring_head = s_captures.empty() ? 0 : capture.offset;
+
+    if (capture.size > s_load_buffer.size())
+      s_load_buffer.reset(capture.size);
+
+    const int decompressed_size = LZ4_decompress_safe(
+        reinterpret_cast<const char*>(s_ring.data() + capture.offset),
+        reinterpret_cast<char*>(s_load_buffer.data()), static_cast<int>(capture.compressed_size),
+        static_cast<int>(capture.size));
+    if (decompressed_size != static_cast<int>(capture.size))
+    {
+      ERROR_LOG_FMT(CORE, "Rewind: Failed to decompress state");
+      return false;
+    }
+  }
+
+  State::LoadFromBuffer(system, s_load_buffer);
+  return true;
+}
+
+size_t GetCaptureCount()
+{
+  std::lock_guard lk(s_mutex);
+  return s_captures.size();
+}
+}  // namespace Rewind
@@ -0,0 +1,30 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Keeps a ring of compressed in-memory savestates that are captured periodically,
+// so that emulation can be stepped backwards.
+
+#pragma once
+
+#include <cstddef>
+
+namespace Core
+{
+class System;
+}
+
+namespace Rewind
+{
+// Must be called right after CoreTiming has been initialized.
+void Init(Core::System& system);
+void Shutdown();
+
+// Makes sure the capture event is scheduled after its scheduling has been replaced by a savestate.
+void OnStateLoaded(Core::System& system);
+
+// Loads the most recent capture and discards it, so that repeated calls go further back in time.
+// Returns false if there is nothing to step back to.
+bool StepBack(Core::System& system);
+
+size_t GetCaptureCount();
+}  // namespace Rewind
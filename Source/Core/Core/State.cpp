@@ -4,12 +4,16 @@
 #include "Core/State.h"
 
 #include <algorithm>
+#include <atomic>
+#include <charconv>
 #include <condition_variable>
 #include <filesystem>
 #include <locale>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -19,20 +23,26 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <xxhash.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Contains.h"
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
 #include "Common/Thread.h"
+#include "Common/ThreadPool.h"
 #include "Common/TimeUtil.h"
 #include "Common/Version.h"
 #include "Common/WorkQueueThread.h"
 
 #include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -43,6 +53,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/Rewind.h"
 #include "Core/System.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
@@ -75,6 +86,8 @@ struct CompressAndDumpState_args
 {
   Common::UniqueBuffer<u8> buffer;
   std::string filename;
+  CompressionType compression_type = CompressionType::LZ4;
+  bool use_delta_states = false;
   std::shared_ptr<Common::Event> state_write_done_event;
 };
 
@@ -97,7 +110,11 @@ static std::condition_variable s_state_write_queue_is_empty;
 constexpr u32 STATE_VERSION = 175;  // Last changed in PR 13751
 
 // Increase this if the StateExtendedHeader definition changes
-constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
+constexpr u32 EXTENDED_HEADER_VERSION = 2;
+
+// States with this extended header version have no chunk table and store their LZ4 payload
+// sequentially, with each block prefixed by its compressed size.
+constexpr u32 EXTENDED_HEADER_VERSION_WITHOUT_CHUNK_TABLE = 1;
 
 // Change this if we ever need to store more data in the extended header
 constexpr u32 COMPRESSED_DATA_OFFSET = 0;
@@ -129,11 +146,49 @@ enum
 
 static bool s_use_compression = true;
 
+// Compressed payloads are split into chunks of this size that can be (de)compressed in parallel
+constexpr u32 COMPRESSION_CHUNK_SIZE = 0x100000;
+
+// Favor speed, as savestates are often made in quick succession
+constexpr int ZSTD_COMPRESSION_LEVEL = 1;
+
+// Shared by the savestate worker thread when saving and the CPU thread when loading
+static Common::ThreadPool s_compression_pool;
+
+// Granularity at which delta states are compared against their base state
+constexpr u32 DELTA_PAGE_SIZE = 0x1000;
+
+// A new base state is taken once more than this percentage of pages differ from the current one
+constexpr u64 DELTA_REBASE_THRESHOLD_PERCENT = 50;
+
+// The uncompressed contents of the base state that delta states are currently saved against.
+// Only modified by the savestate worker thread.
+static Common::UniqueBuffer<u8> s_delta_base;
+static u64 s_delta_base_hash = 0;
+static std::mutex s_delta_base_mutex;
+
 void EnableCompression(bool compression)
 {
   s_use_compression = compression;
 }
 
+static CompressionType GetCompressionTypeForSaving()
+{
+  if (!s_use_compression)
+    return CompressionType::Uncompressed;
+
+  // Delta states are enabled separately and compress their pages using one of the other types.
+  const CompressionType compression_type = Config::Get(Config::MAIN_SAVESTATE_COMPRESSION);
+  switch (compression_type)
+  {
+  case CompressionType::Uncompressed:
+  case CompressionType::Zstd:
+    return compression_type;
+  default:
+    return CompressionType::LZ4;
+  }
+}
+
 static void DoState(Core::System& system, PointerWrap& p)
 {
   bool is_wii = system.IsWii() || system.IsMIOS();
@@ -198,6 +253,9 @@ static void DoState(Core::System& system, PointerWrap& p)
 #ifdef USE_RETRO_ACHIEVEMENTS
   AchievementManager::GetInstance().DoState(p);
 #endif  // USE_RETRO_ACHIEVEMENTS
+
+  if (p.IsReadMode())
+    Rewind::OnStateLoaded(system);
 }
 
 void LoadFromBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
@@ -224,8 +282,9 @@ void LoadFromBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
       true);
 }
 
-void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+size_t SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
 {
+  size_t state_size = 0;
   Core::RunOnCPUThread(
       system,
       [&] {
@@ -240,8 +299,12 @@ void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
         ptr = buffer.data();
         PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
         DoState(system, p);
+
+        if (p.IsWriteMode())
+          state_size = new_buffer_size;
       },
       true);
+  return state_size;
 }
 
 namespace
@@ -308,50 +371,116 @@ static std::vector<SlotWithTimestamp> GetUsedSlotsWithTimestamp()
   return result;
 }
 
-static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+// A state payload, split into chunks that were compressed independently of each other
+struct StatePayload
 {
-  u64 total_bytes_compressed = 0;
+  CompressionType compression_type = CompressionType::Uncompressed;
+  const u8* data = nullptr;
+  size_t size = 0;
+  std::vector<Common::UniqueBuffer<u8>> compressed_chunks;
+  std::vector<u32> compressed_chunk_sizes;
+};
 
-  while (true)
+static bool CompressChunk(CompressionType compression_type, const u8* data, size_t size,
+                          Common::UniqueBuffer<u8>& compressed_chunk, u32& compressed_size)
+{
+  switch (compression_type)
   {
-    const u64 bytes_left_to_compress = size - total_bytes_compressed;
-
-    const int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    Common::UniqueBuffer<char> compressed_buffer(LZ4_compressBound(bytes_to_compress));
+  case CompressionType::LZ4:
+  {
+    compressed_chunk.reset(LZ4_compressBound(static_cast<int>(size)));
     const int compressed_len = LZ4_compress_default(
-        reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed, compressed_buffer.get(),
-        bytes_to_compress, int(compressed_buffer.size()));
-
+        reinterpret_cast<const char*>(data), reinterpret_cast<char*>(compressed_chunk.data()),
+        static_cast<int>(size), static_cast<int>(compressed_chunk.size()));
     if (compressed_len == 0)
+      return false;
+
+    compressed_size = static_cast<u32>(compressed_len);
+    return true;
+  }
+  case CompressionType::Zstd:
+  {
+    compressed_chunk.reset(ZSTD_compressBound(size));
+    const size_t compressed_len = ZSTD_compress(compressed_chunk.data(), compressed_chunk.size(),
+                                                data, size, ZSTD_COMPRESSION_LEVEL);
+    if (ZSTD_isError(compressed_len))
+      return false;
+
+    compressed_size = static_cast<u32>(compressed_len);
+    return true;
+  }
+  default:
+    return false;
+  }
+}
+
+static StatePayload CompressPayload(CompressionType compression_type, const u8* data, size_t size)
+{
+  StatePayload payload;
+  payload.compression_type = compression_type;
+  payload.data = data;
+  payload.size = size;
+
+  if (payload.compression_type == CompressionType::Uncompressed)
+    return payload;
+
+  const size_t chunk_count = (size + COMPRESSION_CHUNK_SIZE - 1) / COMPRESSION_CHUNK_SIZE;
+  payload.compressed_chunks.resize(chunk_count);
+  payload.compressed_chunk_sizes.resize(chunk_count);
+
+  std::atomic<bool> success = true;
+  s_compression_pool.ParallelFor(chunk_count, [&](size_t i) {
+    const size_t offset = i * COMPRESSION_CHUNK_SIZE;
+    const size_t length = std::min<size_t>(COMPRESSION_CHUNK_SIZE, size - offset);
+    if (!CompressChunk(payload.compression_type, data + offset, length,
+                       payload.compressed_chunks[i], payload.compressed_chunk_sizes[i]))
     {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
+      success = false;
     }
+  });
+
+  if (!success)
+  {
+    PanicAlertFmtT("Internal compression error - compression failed");
+    payload.compression_type = CompressionType::Uncompressed;
+    payload.compressed_chunks.clear();
+    payload.compressed_chunk_sizes.clear();
+  }
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
+  return payload;
+}
 
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == size)
-      break;
+static void WritePayloadToFile(const StatePayload& payload, File::IOFile& f)
+{
+  if (payload.compression_type == CompressionType::Uncompressed)
+  {
+    f.WriteBytes(payload.data, payload.size);
+    return;
   }
+
+  for (size_t i = 0; i < payload.compressed_chunks.size(); ++i)
+    f.WriteBytes(payload.compressed_chunks[i].data(), payload.compressed_chunk_sizes[i]);
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type, const StatePayload& payload)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
+  StateChunkTableHeader& chunk_table_header = extended_header.chunk_table_header;
+  chunk_table_header.chunk_size = COMPRESSION_CHUNK_SIZE;
+  chunk_table_header.chunk_count = static_cast<u32>(payload.compressed_chunk_sizes.size());
+  extended_header.compressed_chunk_sizes = payload.compressed_chunk_sizes;
+
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(size_t uncompressed_size, CompressionType compression_type,
+                               const StatePayload& payload, File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -363,22 +492,22 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, uncompressed_size, compression_type, payload);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
   f.WriteString(header.version_string);
 
   f.WriteArray(&extended_header.base_header, 1);
-  // If StateExtendedHeader is amended to include more than the base, add WriteBytes() calls here.
+  f.WriteArray(&extended_header.chunk_table_header, 1);
+  f.WriteArray(extended_header.compressed_chunk_sizes.data(),
+               extended_header.compressed_chunk_sizes.size());
+  // If StateExtendedHeader is amended to include more than the above, add WriteBytes() calls
+  // here.
 }
 
-static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args& save_args)
+static std::string MakeTempFilename(const std::string& filename)
 {
-  const u8* const buffer_data = save_args.buffer.data();
-  const size_t buffer_size = save_args.buffer.size();
-  const std::string& filename = save_args.filename;
-
   // Find free temporary filename.
   // TODO: The file exists check and the actual opening of the file should be atomic, we don't have
   // functions for that.
@@ -390,6 +519,222 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     ++temp_counter;
   } while (File::Exists(temp_filename));
 
+  return temp_filename;
+}
+
+static std::string MakeDeltaBaseFilename(u64 base_hash)
+{
+  return fmt::format("{}{}.{:016x}.sbase", File::GetUserPath(D_STATESAVES_IDX),
+                     SConfig::GetInstance().GetGameID(), base_hash);
+}
+
+// Makes the given state the base for subsequent delta states and writes it to disk as a regular
+// state file, unless a base with identical contents already exists. hash is set to the hash of the
+// new base.
+static bool SetDeltaBase(CompressionType compression_type, const u8* data, size_t size, u64& hash)
+{
+  hash = XXH3_64bits(data, size);
+  {
+    std::lock_guard lk(s_delta_base_mutex);
+    s_delta_base.reset(size);
+    std::copy_n(data, size, s_delta_base.data());
+    s_delta_base_hash = hash;
+  }
+
+  const std::string base_filename = MakeDeltaBaseFilename(hash);
+  if (File::Exists(base_filename))
+    return true;
+
+  const std::string temp_filename = MakeTempFilename(base_filename);
+  File::IOFile f(temp_filename, "wb");
+  if (!f)
+    return false;
+
+  const StatePayload payload = CompressPayload(compression_type, data, size);
+  WriteHeadersToFile(size, payload.compression_type, payload, f);
+  WritePayloadToFile(payload, f);
+
+  if (!f.IsGood() || !f.Close() || !File::Rename(temp_filename, base_filename))
+  {
+    File::Delete(temp_filename);
+    return false;
+  }
+
+  return true;
+}
+
+// Returns false if the state couldn't be stored as a delta and has to be written in full.
+// Otherwise, base_hash is set to the hash of the base state it was saved against.
+static bool WriteDeltaStateToFile(CompressionType compression_type, const u8* data, size_t size,
+                                  u64& base_hash, File::IOFile& f)
+{
+  const u64 page_count = (size + DELTA_PAGE_SIZE - 1) / DELTA_PAGE_SIZE;
+
+  std::vector<u32> dirty_pages;
+  u64 dirty_size = 0;
+  bool had_base;
+  u64 base_size;
+  {
+    std::lock_guard lk(s_delta_base_mutex);
+    had_base = !s_delta_base.empty();
+    base_hash = s_delta_base_hash;
+    base_size = s_delta_base.size();
+    if (had_base)
+    {
+      for (u64 i = 0; i < page_count; ++i)
+      {
+        const u64 offset = i * DELTA_PAGE_SIZE;
+        const u64 length = std::min<u64>(DELTA_PAGE_SIZE, size - offset);
+        if (offset + length > s_delta_base.size() ||
+            std::memcmp(data + offset, s_delta_base.data() + offset, length) != 0)
+        {
+          dirty_pages.push_back(static_cast<u32>(i));
+          dirty_size += length;
+        }
+      }
+    }
+  }
+
+  if (!had_base || dirty_size * 100 > size * DELTA_REBASE_THRESHOLD_PERCENT)
+  {
+    if (!SetDeltaBase(compression_type, data, size, base_hash))
+    {
+      Core::DisplayMessage("Failed to write base state, saving full state instead", 2000);
+      std::lock_guard lk(s_delta_base_mutex);
+      s_delta_base.reset();
+      return false;
+    }
+
+    // The state is now identical to its base.
+    base_size = size;
+    dirty_pages.clear();
+    dirty_size = 0;
+  }
+
+  Common::UniqueBuffer<u8> dirty_data(dirty_size);
+  u8* dirty_ptr = dirty_data.data();
+  for (const u32 page : dirty_pages)
+  {
+    const u64 offset = u64(page) * DELTA_PAGE_SIZE;
+    const u64 length = std::min<u64>(DELTA_PAGE_SIZE, size - offset);
+    dirty_ptr = std::copy_n(data + offset, length, dirty_ptr);
+  }
+
+  StateDeltaHeader delta_header{};
+  delta_header.base_hash = base_hash;
+  delta_header.base_size = base_size;
+  delta_header.page_size = DELTA_PAGE_SIZE;
+  delta_header.dirty_page_count = static_cast<u32>(dirty_pages.size());
+
+  const StatePayload payload =
+      CompressPayload(compression_type, dirty_data.data(), dirty_data.size());
+  delta_header.payload_compression_type = payload.compression_type;
+
+  WriteHeadersToFile(size, CompressionType::Delta, payload, f);
+  f.WriteArray(&delta_header, 1);
+  f.WriteArray(dirty_pages.data(), dirty_pages.size());
+  WritePayloadToFile(payload, f);
+
+  return true;
+}
+
+// Delta states only refer to their base state by hash, so which state files were saved against
+// which base state is recorded in a list next to the base states, wherever the state files are. A
+// base state is deleted once no state file in that list refers to it anymore.
+static std::string MakeDeltaBaseReferencesFilename()
+{
+  return fmt::format("{}{}.sbase.refs", File::GetUserPath(D_STATESAVES_IDX),
+                     SConfig::GetInstance().GetGameID());
+}
+
+static std::map<std::string, u64> ReadDeltaBaseReferences()
+{
+  std::map<std::string, u64> references;
+  std::string contents;
+  if (!File::ReadFileToString(MakeDeltaBaseReferencesFilename(), contents))
+    return references;
+
+  // Each line is the hash of a base state followed by the path of a state saved against it.
+  for (const std::string& line : SplitString(contents, '\n'))
+  {
+    const size_t separator = line.find(' ');
+    u64 base_hash;
+    if (separator == std::string::npos ||
+        std::from_chars(line.data(), line.data() + separator, base_hash, 16).ec != std::errc{})
+    {
+      continue;
+    }
+    references.emplace(line.substr(separator + 1), base_hash);
+  }
+  return references;
+}
+
+static void WriteDeltaBaseReferences(const std::map<std::string, u64>& references)
+{
+  std::string contents;
+  for (const auto& [filename, base_hash] : references)
+    contents += fmt::format("{:016x} {}\n", base_hash, filename);
+
+  if (!File::WriteStringToFile(MakeDeltaBaseReferencesFilename(), contents))
+    Core::DisplayMessage("Failed to write the list of base states", 2000);
+}
+
+// Records which base state the file that was just saved to filename refers to, if any, and deletes
+// the base states that no state refers to anymore. backup_filename is where the state that was
+// previously at filename has been moved to, or empty if it wasn't moved.
+static void UpdateDeltaBaseReferences(const std::string& filename, bool saved,
+                                      std::optional<u64> base_hash,
+                                      const std::string& backup_filename)
+{
+  std::map<std::string, u64> references = ReadDeltaBaseReferences();
+
+  std::set<u64> previous_bases;
+  for (const auto& reference : references)
+    previous_bases.insert(reference.second);
+
+  if (!backup_filename.empty())
+  {
+    const auto it = references.find(filename);
+    if (it != references.end())
+      references.insert_or_assign(backup_filename, it->second);
+    else
+      references.erase(backup_filename);
+  }
+
+  if (saved && base_hash)
+    references.insert_or_assign(filename, *base_hash);
+  else if (saved || !backup_filename.empty())
+    references.erase(filename);
+
+  // States that have been deleted don't need their base anymore.
+  std::erase_if(references, [](const auto& reference) { return !File::Exists(reference.first); });
+
+  std::set<u64> used_bases;
+  for (const auto& reference : references)
+    used_bases.insert(reference.second);
+  {
+    std::lock_guard lk(s_delta_base_mutex);
+    if (!s_delta_base.empty())
+      used_bases.insert(s_delta_base_hash);
+  }
+
+  for (const u64 previous_base : previous_bases)
+  {
+    if (!used_bases.contains(previous_base))
+      File::Delete(MakeDeltaBaseFilename(previous_base));
+  }
+
+  WriteDeltaBaseReferences(references);
+}
+
+static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args& save_args)
+{
+  const u8* const buffer_data = save_args.buffer.data();
+  const size_t buffer_size = save_args.buffer.size();
+  const std::string& filename = save_args.filename;
+
+  const std::string temp_filename = MakeTempFilename(filename);
+
   File::IOFile f(temp_filename, "wb");
   if (!f)
   {
@@ -397,12 +742,20 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     return;
   }
 
-  WriteHeadersToFile(buffer_size, f);
-
-  if (s_use_compression)
-    CompressBufferToFile(buffer_data, buffer_size, f);
+  std::optional<u64> base_hash;
+  u64 delta_base_hash;
+  if (save_args.use_delta_states && WriteDeltaStateToFile(save_args.compression_type, buffer_data,
+                                                          buffer_size, delta_base_hash, f))
+  {
+    base_hash = delta_base_hash;
+  }
   else
-    f.WriteBytes(buffer_data, buffer_size);
+  {
+    const StatePayload payload =
+        CompressPayload(save_args.compression_type, buffer_data, buffer_size);
+    WriteHeadersToFile(buffer_size, payload.compression_type, payload, f);
+    WritePayloadToFile(payload, f);
+  }
 
   if (!f.IsGood())
     Core::DisplayMessage("Failed to write state file", 2000);
@@ -415,6 +768,7 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     std::lock_guard lk(s_save_thread_mutex);
 
     // Backup existing state (overwriting an existing backup, if any).
+    bool backed_up = false;
     if (File::Exists(filename))
     {
       if (File::Exists(last_state_filename))
@@ -426,9 +780,10 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
       {
         Core::DisplayMessage("Failed to move previous state to state undo backup", 1000);
       }
-      else if (File::Exists(dtmname))
+      else
       {
-        if (!File::Rename(dtmname, last_state_dtmname))
+        backed_up = true;
+        if (File::Exists(dtmname) && !File::Rename(dtmname, last_state_dtmname))
           Core::DisplayMessage("Failed to move previous state's dtm to state undo backup", 1000);
       }
     }
@@ -445,7 +800,8 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     if (!f.Close())
       Core::DisplayMessage("Failed to close state file", 2000);
 
-    if (!File::Rename(temp_filename, filename))
+    const bool saved = File::Rename(temp_filename, filename);
+    if (!saved)
     {
       Core::DisplayMessage("Failed to rename state file", 2000);
     }
@@ -454,6 +810,10 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
       const std::filesystem::path temp_path(filename);
       Core::DisplayMessage(fmt::format("Saved State to {}", temp_path.filename().string()), 2000);
     }
+
+    // Overwriting a state can leave the base it was saved against unused.
+    UpdateDeltaBaseReferences(filename, saved, base_hash,
+                              backed_up ? last_state_filename : std::string());
   }
 }
 
@@ -492,6 +852,8 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           CompressAndDumpState_args save_args;
           save_args.buffer = std::move(current_buffer);
           save_args.filename = filename;
+          save_args.compression_type = GetCompressionTypeForSaving();
+          save_args.use_delta_states = Config::Get(Config::MAIN_SAVESTATE_DELTA);
           if (wait)
           {
             sync_event = std::make_shared<Common::Event>();
@@ -705,6 +1067,96 @@ static bool DecompressLZ4(Common::UniqueBuffer<u8>& raw_buffer, u64 size, File::
   }
 }
 
+static bool DecompressChunk(CompressionType compression_type, const u8* compressed_data,
+                            size_t compressed_size, u8* data, size_t size)
+{
+  switch (compression_type)
+  {
+  case CompressionType::LZ4:
+    return LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data),
+                               reinterpret_cast<char*>(data), static_cast<int>(compressed_size),
+                               static_cast<int>(size)) == static_cast<int>(size);
+  case CompressionType::Zstd:
+  {
+    const size_t decompressed_size = ZSTD_decompress(data, size, compressed_data, compressed_size);
+    return !ZSTD_isError(decompressed_size) && decompressed_size == size;
+  }
+  default:
+    return false;
+  }
+}
+
+static bool DecompressChunks(Common::UniqueBuffer<u8>& raw_buffer, u64 size,
+                             CompressionType compression_type,
+                             const StateExtendedHeader& extended_header, File::IOFile& f)
+{
+  const u64 chunk_size = extended_header.chunk_table_header.chunk_size;
+  const std::vector<u32>& compressed_chunk_sizes = extended_header.compressed_chunk_sizes;
+  if (chunk_size == 0 || compressed_chunk_sizes.size() != (size + chunk_size - 1) / chunk_size)
+  {
+    PanicAlertFmt("State chunk table corrupted");
+    return false;
+  }
+
+  std::vector<u64> compressed_offsets(compressed_chunk_sizes.size() + 1);
+  for (size_t i = 0; i < compressed_chunk_sizes.size(); ++i)
+    compressed_offsets[i + 1] = compressed_offsets[i] + compressed_chunk_sizes[i];
+
+  Common::UniqueBuffer<u8> compressed_data(compressed_offsets.back());
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.reset(size);
+
+  std::atomic<bool> success = true;
+  s_compression_pool.ParallelFor(compressed_chunk_sizes.size(), [&](size_t i) {
+    const u64 offset = i * chunk_size;
+    if (!DecompressChunk(compression_type, compressed_data.data() + compressed_offsets[i],
+                         compressed_chunk_sizes[i], raw_buffer.data() + offset,
+                         std::min(chunk_size, size - offset)))
+    {
+      success = false;
+    }
+  });
+
+  if (!success)
+  {
+    PanicAlertFmtT("Internal decompression error - decompression failed");
+    return false;
+  }
+
+  return true;
+}
+
+static bool DecompressPayload(Common::UniqueBuffer<u8>& raw_buffer, u64 size,
+                              CompressionType compression_type,
+                              const StateExtendedHeader& extended_header, File::IOFile& f)
+{
+  switch (compression_type)
+  {
+  case CompressionType::Uncompressed:
+    raw_buffer.reset(size);
+    if (!f.ReadBytes(raw_buffer.data(), size))
+    {
+      PanicAlertFmt("Error reading bytes: {0}", size);
+      return false;
+    }
+    return true;
+  case CompressionType::LZ4:
+    if (extended_header.base_header.header_version == EXTENDED_HEADER_VERSION_WITHOUT_CHUNK_TABLE)
+      return DecompressLZ4(raw_buffer, size, f);
+    [[fallthrough]];
+  case CompressionType::Zstd:
+    return DecompressChunks(raw_buffer, size, compression_type, extended_header, f);
+  default:
+    PanicAlertFmt("Unknown compression type {0}", static_cast<u16>(compression_type));
+    return false;
+  }
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -752,6 +1204,98 @@ static bool ValidateHeaders(const StateHeader& header)
   return success;
 }
 
+static bool ReadStateFileData(File::IOFile& f, Common::UniqueBuffer<u8>& ret_data,
+                              bool allow_delta);
+
+static bool GetDeltaBase(u64 base_hash, u64 base_size, Common::UniqueBuffer<u8>& base)
+{
+  {
+    std::lock_guard lk(s_delta_base_mutex);
+    if (s_delta_base_hash == base_hash && s_delta_base.size() == base_size)
+    {
+      base.reset(base_size);
+      std::copy_n(s_delta_base.data(), base_size, base.data());
+      return true;
+    }
+  }
+
+  File::IOFile f(MakeDeltaBaseFilename(base_hash), "rb");
+  if (!ReadStateFileData(f, base, false))
+    return false;
+
+  return base.size() == base_size && XXH3_64bits(base.data(), base.size()) == base_hash;
+}
+
+static bool DecompressDelta(Common::UniqueBuffer<u8>& raw_buffer, u64 size,
+                            const StateExtendedHeader& extended_header, File::IOFile& f)
+{
+  StateDeltaHeader delta_header;
+  if (!f.ReadArray(&delta_header, 1))
+  {
+    PanicAlertFmt("Unable to read delta state header");
+    return false;
+  }
+
+  const u64 page_size = delta_header.page_size;
+  if (page_size == 0)
+  {
+    PanicAlertFmt("Delta state header corrupted");
+    return false;
+  }
+
+  const u64 page_count = (size + page_size - 1) / page_size;
+  std::vector<u32> dirty_pages(delta_header.dirty_page_count);
+  if (!f.ReadArray(dirty_pages.data(), dirty_pages.size()))
+  {
+    PanicAlertFmt("Could not read delta state page list");
+    return false;
+  }
+
+  u64 dirty_size = 0;
+  for (size_t i = 0; i < dirty_pages.size(); ++i)
+  {
+    if (dirty_pages[i] >= page_count || (i != 0 && dirty_pages[i] <= dirty_pages[i - 1]))
+    {
+      PanicAlertFmt("Delta state page list corrupted");
+      return false;
+    }
+    dirty_size += std::min(page_size, size - dirty_pages[i] * page_size);
+  }
+
+  Common::UniqueBuffer<u8> dirty_data;
+  if (dirty_size != 0 &&
+      !DecompressPayload(dirty_data, dirty_size,
+                         static_cast<CompressionType>(delta_header.payload_compression_type),
+                         extended_header, f))
+  {
+    return false;
+  }
+
+  Common::UniqueBuffer<u8> base;
+  if (!GetDeltaBase(delta_header.base_hash, delta_header.base_size, base))
+  {
+    Core::DisplayMessage(
+        fmt::format("The base state {:016x} of this state is missing or has been modified",
+                    delta_header.base_hash),
+        OSD::Duration::NORMAL);
+    return false;
+  }
+
+  raw_buffer.reset(size);
+  std::copy_n(base.data(), std::min<u64>(base.size(), size), raw_buffer.data());
+
+  const u8* dirty_ptr = dirty_data.data();
+  for (const u32 page : dirty_pages)
+  {
+    const u64 offset = page * page_size;
+    const u64 length = std::min(page_size, size - offset);
+    std::copy_n(dirty_ptr, length, raw_buffer.data() + offset);
+    dirty_ptr += length;
+  }
+
+  return true;
+}
+
 static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<u8>& ret_data)
 {
   File::IOFile f;
@@ -772,22 +1316,53 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
     f.Open(filename, "rb");
   }
 
+  ReadStateFileData(f, ret_data, true);
+}
+
+static bool ReadStateFileData(File::IOFile& f, Common::UniqueBuffer<u8>& ret_data,
+                              bool allow_delta)
+{
   StateHeader header;
   if (!ReadStateHeaderFromFile(header, f) || !ValidateHeaders(header))
-    return;
+    return false;
 
   StateExtendedHeader extended_header;
   if (!f.ReadArray(&extended_header.base_header, 1))
   {
     PanicAlertFmt("Unable to read state header");
-    return;
+    return false;
   }
-  // If StateExtendedHeader is amended to include more than the base, add ReadBytes() calls here.
 
-  if (extended_header.base_header.header_version != EXTENDED_HEADER_VERSION)
+  const u64 uncompressed_size = extended_header.base_header.uncompressed_size;
+  if (extended_header.base_header.header_version == EXTENDED_HEADER_VERSION)
+  {
+    StateChunkTableHeader& chunk_table_header = extended_header.chunk_table_header;
+    if (!f.ReadArray(&chunk_table_header, 1) ||
+        (chunk_table_header.chunk_count != 0 &&
+         (chunk_table_header.chunk_size == 0 ||
+          chunk_table_header.chunk_count >
+              (uncompressed_size + chunk_table_header.chunk_size - 1) /
+                  chunk_table_header.chunk_size)))
+    {
+      PanicAlertFmt("State chunk table corrupted");
+      return false;
+    }
+
+    extended_header.compressed_chunk_sizes.resize(chunk_table_header.chunk_count);
+    if (!f.ReadArray(extended_header.compressed_chunk_sizes.data(),
+                     extended_header.compressed_chunk_sizes.size()))
+    {
+      PanicAlertFmt("Unable to read state chunk table");
+      return false;
+    }
+    // If StateExtendedHeader is amended to include more than the above, add ReadBytes() calls
+    // here.
+  }
+  else if (extended_header.base_header.header_version !=
+           EXTENDED_HEADER_VERSION_WITHOUT_CHUNK_TABLE)
   {
     PanicAlertFmt("State header corrupted");
-    return;
+    return false;
   }
 
   Common::UniqueBuffer<u8> buffer;
@@ -795,24 +1370,41 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
   switch (extended_header.base_header.compression_type)
   {
   case CompressionType::LZ4:
+  case CompressionType::Zstd:
   {
     Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
-    if (!DecompressLZ4(buffer, extended_header.base_header.uncompressed_size, f))
-      return;
+    const auto compression_type =
+        static_cast<CompressionType>(extended_header.base_header.compression_type);
+    if (!DecompressPayload(buffer, uncompressed_size, compression_type, extended_header, f))
+    {
+      return false;
+    }
+
+    break;
+  }
+  case CompressionType::Delta:
+  {
+    // Delta states are only ever saved against full states, so don't follow chains of them.
+    if (!allow_delta)
+    {
+      PanicAlertFmt("Base state of delta state is itself a delta state");
+      return false;
+    }
+
+    if (!DecompressDelta(buffer, uncompressed_size, extended_header, f))
+      return false;
 
     break;
   }
   case CompressionType::Uncompressed:
   {
-    u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
-                     header.version_header.version_string_length + sizeof(StateExtendedBaseHeader) +
-                     extended_header.base_header.payload_offset;
+    const u64 header_len = f.Tell() + extended_header.base_header.payload_offset;
 
     u64 file_size = f.GetSize();
     if (file_size < header_len)
     {
       PanicAlertFmt("State header length corrupted");
-      return;
+      return false;
     }
 
     const auto size = static_cast<size_t>(file_size - header_len);
@@ -821,17 +1413,18 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
     if (!f.ReadBytes(buffer.data(), size))
     {
       PanicAlertFmt("Error reading bytes: {0}", size);
-      return;
+      return false;
     }
     break;
   }
   default:
     PanicAlertFmt("Unknown compression type {0}", extended_header.base_header.compression_type);
-    return;
+    return false;
   }
 
   // all good
   ret_data.swap(buffer);
+  return true;
 }
 
 void LoadAs(Core::System& system, const std::string& filename)
@@ -924,6 +1517,8 @@ void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
 
 void Init(Core::System& system)
 {
+  s_compression_pool.Reset("Savestate Compression", Common::ThreadPool::GetDefaultThreadCount());
+
   s_save_thread.Reset("Savestate Worker", [&system](CompressAndDumpState_args args) {
     CompressAndDumpState(system, args);
 
@@ -941,9 +1536,14 @@ void Init(Core::System& system)
 void Shutdown()
 {
   s_save_thread.Shutdown();
+  s_compression_pool.Shutdown();
 
   std::lock_guard lk(s_undo_load_buffer_mutex);
   s_undo_load_buffer.reset();
+
+  std::lock_guard delta_lk(s_delta_base_mutex);
+  s_delta_base.reset();
+  s_delta_base_hash = 0;
 }
 
 static std::string MakeStateFilename(int number)
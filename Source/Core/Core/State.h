@@ -9,6 +9,7 @@
 #include <functional>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Common/Buffer.h"
 #include "Common/CommonTypes.h"
@@ -55,6 +56,9 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // Only the pages that differ from a base state are stored, see StateDeltaHeader.
+  Delta = 2,
+  Zstd = 3,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -72,18 +76,53 @@ static_assert(offsetof(StateExtendedBaseHeader, payload_offset) == 4);
 static_assert(offsetof(StateExtendedBaseHeader, uncompressed_size) == 8);
 static_assert(std::is_trivially_copyable_v<StateExtendedBaseHeader>);
 
+// Compressed payloads are split into chunks that can be decompressed independently of each other.
+// Every chunk except the last one decompresses to chunk_size bytes.
+struct StateChunkTableHeader
+{
+  u32 chunk_size;
+  u32 chunk_count;
+};
+constexpr size_t CHUNK_TABLE_HEADER_SIZE = sizeof(StateChunkTableHeader);
+static_assert(CHUNK_TABLE_HEADER_SIZE == 8);
+static_assert(std::is_trivially_copyable_v<StateChunkTableHeader>);
+
 struct StateExtendedHeader
 {
   StateExtendedBaseHeader base_header;
+  StateChunkTableHeader chunk_table_header;
+  // The compressed size of each chunk, stored directly after chunk_table_header.
+  std::vector<u32> compressed_chunk_sizes;
   // Feel free to add new fields here, adjusting COMPRESSED_DATA_OFFSET accordingly, as well as
-  // CreateExtendedHeader(). Add the appropriate IOFile read/write calls within LoadFileStateData()
+  // CreateExtendedHeader(). Add the appropriate IOFile read/write calls within ReadStateFileData()
   // and WriteHeadersToFile()
 };
 
+// Follows the extended header of states using CompressionType::Delta. It is followed by
+// dirty_page_count u32 page indices and then the contents of those pages, compressed using
+// payload_compression_type and described by the chunk table of the extended header. The remaining
+// pages are taken from the base state, which is a regular state file named after base_hash.
+struct StateDeltaHeader
+{
+  u64 base_hash;
+  u64 base_size;
+  u32 page_size;
+  u32 dirty_page_count;
+  u16 payload_compression_type;
+  u16 reserved1;
+  u32 reserved2;
+};
+constexpr size_t DELTA_HEADER_SIZE = sizeof(StateDeltaHeader);
+static_assert(DELTA_HEADER_SIZE == 32);
+static_assert(offsetof(StateDeltaHeader, page_size) == 16);
+static_assert(offsetof(StateDeltaHeader, payload_compression_type) == 24);
+static_assert(std::is_trivially_copyable_v<StateDeltaHeader>);
+
 void Init(Core::System& system);
 
 void Shutdown();
 
+// Overrides Config::MAIN_SAVESTATE_COMPRESSION with CompressionType::Uncompressed when disabled.
 void EnableCompression(bool compression);
 
 bool ReadHeader(const std::string& filename, StateHeader& header);
@@ -106,7 +145,9 @@ void Load(Core::System& system, int slot);
 void SaveAs(Core::System& system, const std::string& filename, bool wait = false);
 void LoadAs(Core::System& system, const std::string& filename);
 
-void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
+// The buffer is only reallocated if it is too small to hold the state.
+// Returns the size of the state, which may be smaller than the size of the buffer.
+size_t SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
 void LoadFromBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
 
 void LoadLastSaved(Core::System& system, int i = 1);
@@ -25,6 +25,7 @@
 
 namespace DiscIO
 {
+class CompressorPool;
 enum class WIARVZCompressionType : u32;
 
 // Increment CACHE_REVISION (GameFileCache.cpp) if the enum below is modified
@@ -73,6 +74,8 @@ public:
   // Returns 0 if the format does not use blocks
   virtual u64 GetBlockSize() const = 0;
   virtual bool HasFastRandomAccessInBlock() const = 0;
+  // Whether the reader already reads ahead on its own when it's read sequentially
+  virtual bool PrefetchesSequentialReads() const { return false; }
   virtual std::string GetCompressionMethod() const = 0;
   virtual std::optional<int> GetCompressionLevel() const = 0;
 
@@ -196,12 +199,13 @@ using CompressCB = std::function<bool(const std::string& text, float percent)>;
 
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int sector_size,
-                  const CompressCB& callback);
+                  const CompressCB& callback, CompressorPool* compressor_pool = nullptr);
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, const CompressCB& callback);
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, const CompressCB& callback);
+                       int chunk_size, const CompressCB& callback,
+                       CompressorPool* compressor_pool = nullptr);
 
 }  // namespace DiscIO
@@ -3,9 +3,14 @@
 
 #include "DiscIO/CachedBlob.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstring>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -16,7 +21,20 @@
 
 namespace DiscIO
 {
-class CacheFiller final
+// Shared between all copies of a CachedBlobReader.
+class BlobCache
+{
+public:
+  virtual ~BlobCache() = default;
+
+  // Reads from the cache, using the given reader for whatever isn't cached.
+  virtual bool Read(u64 offset, u64 size, u8* out_ptr, BlobReader& reader) = 0;
+
+  virtual bool HasFastRandomAccessInBlock(const BlobReader& reader) const = 0;
+};
+
+// Reads the entire disc into memory on a background thread.
+class CacheFiller final : public BlobCache
 {
 public:
   explicit CacheFiller(std::unique_ptr<BlobReader> reader, bool attempt_to_scrub)
@@ -24,13 +42,22 @@ public:
   {
   }
 
-  ~CacheFiller()
+  ~CacheFiller() override
   {
     m_stop_thread.store(true, std::memory_order_relaxed);
     m_thread.join();
   }
 
-  bool Read(u64 offset, u64 size, u8* out_ptr)
+  bool Read(u64 offset, u64 size, u8* out_ptr, BlobReader& reader) override
+  {
+    return ReadFromCache(offset, size, out_ptr) || reader.Read(offset, size, out_ptr);
+  }
+
+  // Everything ends up in memory eventually.
+  bool HasFastRandomAccessInBlock(const BlobReader&) const override { return true; }
+
+private:
+  bool ReadFromCache(u64 offset, u64 size, u8* out_ptr)
   {
     if (size == 0)
     {
@@ -56,7 +83,6 @@ public:
     }
   }
 
-private:
   enum class CacheState
   {
     Cached,
@@ -182,26 +208,266 @@ private:
   std::thread m_thread;
 };
 
+// Keeps at most a fixed number of clusters in memory, evicting with the CLOCK algorithm.
+// Clusters that have been read are prioritized over those that were merely prefetched: a background
+// thread only fills slots that have never been used, and its clusters are evicted first.
+class ClusterCache final : public BlobCache
+{
+public:
+  ClusterCache(std::unique_ptr<BlobReader> reader, bool attempt_to_scrub, u64 size_limit)
+      : m_data_size{reader->GetDataSize()},
+        m_slot_count{std::clamp<u64>(size_limit / CLUSTER_SIZE, 1,
+                                     std::max<u64>(GetClusterCount(m_data_size), 1))}
+  {
+    m_data = static_cast<u8*>(m_memory_region.Create(m_slot_count * CLUSTER_SIZE));
+    if (m_data == nullptr)
+    {
+      ERROR_LOG_FMT(DISCIO, "CachedBlobReader: Failed to create memory region.");
+      return;
+    }
+
+    m_slots.resize(m_slot_count);
+    m_thread = std::thread{&ClusterCache::ThreadFunc, this, std::move(reader), attempt_to_scrub};
+  }
+
+  ~ClusterCache() override
+  {
+    m_stop_thread.store(true, std::memory_order_relaxed);
+    if (m_thread.joinable())
+      m_thread.join();
+
+    INFO_LOG_FMT(DISCIO, "CachedBlobReader: {} cluster hits, {} cluster misses", m_hits, m_misses);
+  }
+
+  bool Read(u64 offset, u64 size, u8* out_ptr, BlobReader& reader) override
+  {
+    if (m_data == nullptr)
+      return reader.Read(offset, size, out_ptr);
+
+    while (size > 0)
+    {
+      const u64 cluster_offset = offset % CLUSTER_SIZE;
+      const u64 read_size = std::min(size, CLUSTER_SIZE - cluster_offset);
+      if (!ReadCluster(offset / CLUSTER_SIZE, cluster_offset, read_size, out_ptr, reader))
+        return false;
+
+      offset += read_size;
+      size -= read_size;
+      out_ptr += read_size;
+    }
+
+    return true;
+  }
+
+  // Clusters that aren't cached have to be read from the underlying blob.
+  bool HasFastRandomAccessInBlock(const BlobReader& reader) const override
+  {
+    return reader.HasFastRandomAccessInBlock();
+  }
+
+private:
+  static constexpr u64 CLUSTER_SIZE = DiscScrubber::CLUSTER_SIZE;
+  static constexpr u64 NO_CLUSTER = ~u64{0};
+
+  struct Slot
+  {
+    u64 cluster = NO_CLUSTER;
+    bool referenced = false;
+  };
+
+  static u64 GetClusterCount(u64 data_size)
+  {
+    return (data_size + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+  }
+
+  u64 GetClusterSize(u64 cluster) const
+  {
+    return std::min(CLUSTER_SIZE, m_data_size - cluster * CLUSTER_SIZE);
+  }
+
+  bool ReadCluster(u64 cluster, u64 cluster_offset, u64 size, u8* out_ptr, BlobReader& reader)
+  {
+    {
+      std::lock_guard lk(m_mutex);
+      const auto it = m_cluster_slots.find(cluster);
+      if (it != m_cluster_slots.end())
+      {
+        Slot& slot = m_slots[it->second];
+        slot.referenced = true;
+        std::memcpy(out_ptr, m_data + it->second * CLUSTER_SIZE + cluster_offset, size);
+        ++m_hits;
+        return true;
+      }
+
+      ++m_misses;
+    }
+
+    const u64 cluster_start = cluster * CLUSTER_SIZE;
+    if (cluster_start >= m_data_size || cluster_offset + size > GetClusterSize(cluster))
+      return reader.Read(cluster_start + cluster_offset, size, out_ptr);
+
+    std::vector<u8> buffer(GetClusterSize(cluster));
+    if (!reader.Read(cluster_start, buffer.size(), buffer.data()))
+      return false;
+
+    std::memcpy(out_ptr, buffer.data() + cluster_offset, size);
+
+    std::lock_guard lk(m_mutex);
+    Insert(cluster, buffer, true);
+    return true;
+  }
+
+  // Must be called with m_mutex held. Unreferenced clusters are only stored in unused slots.
+  // Returns false if there was no room.
+  bool Insert(u64 cluster, const std::vector<u8>& data, bool referenced)
+  {
+    if (m_cluster_slots.contains(cluster))
+      return true;
+
+    size_t slot_index;
+    if (m_used_slot_count < m_slot_count)
+      slot_index = m_used_slot_count++;
+    else if (referenced)
+      slot_index = Evict();
+    else
+      return false;
+
+    m_memory_region.EnsureMemoryPagesWritable(slot_index * CLUSTER_SIZE, CLUSTER_SIZE);
+    std::memcpy(m_data + slot_index * CLUSTER_SIZE, data.data(), data.size());
+
+    m_slots[slot_index] = {cluster, referenced};
+    m_cluster_slots.emplace(cluster, slot_index);
+    return true;
+  }
+
+  // Must be called with m_mutex held.
+  size_t Evict()
+  {
+    while (true)
+    {
+      const size_t slot_index = m_clock_hand;
+      m_clock_hand = (m_clock_hand + 1) % m_slot_count;
+
+      Slot& slot = m_slots[slot_index];
+      if (slot.referenced)
+      {
+        slot.referenced = false;
+        continue;
+      }
+
+      m_cluster_slots.erase(slot.cluster);
+      slot.cluster = NO_CLUSTER;
+      return slot_index;
+    }
+  }
+
+  void ThreadFunc(std::unique_ptr<BlobReader> reader, bool attempt_to_scrub)
+  {
+    const auto start_time = Clock::now();
+
+    if (attempt_to_scrub)
+    {
+      const auto volume = CreateVolume(reader->CopyReader());
+      if (volume == nullptr || !m_scrubber.SetupScrub(*volume))
+        WARN_LOG_FMT(DISCIO, "CachedBlobReader: Failed to scrub. All clusters will be cached.");
+    }
+
+    u64 prefetched_count = 0;
+    std::vector<u8> buffer;
+
+    for (u64 cluster = 0; cluster * CLUSTER_SIZE < m_data_size; ++cluster)
+    {
+      if (m_stop_thread.load(std::memory_order_relaxed))
+      {
+        INFO_LOG_FMT(DISCIO, "CachedBlobReader: Stopped");
+        return;
+      }
+
+      if (m_scrubber.CanBlockBeScrubbed(cluster * CLUSTER_SIZE))
+        continue;
+
+      {
+        std::lock_guard lk(m_mutex);
+        if (m_used_slot_count == m_slot_count)
+          break;
+        if (m_cluster_slots.contains(cluster))
+          continue;
+      }
+
+      buffer.resize(GetClusterSize(cluster));
+      if (!reader->Read(cluster * CLUSTER_SIZE, buffer.size(), buffer.data()))
+      {
+        ERROR_LOG_FMT(DISCIO, "CachedBlobReader: Read({}, {}) failed.", cluster * CLUSTER_SIZE,
+                      buffer.size());
+        return;
+      }
+
+      std::lock_guard lk(m_mutex);
+      if (!Insert(cluster, buffer, false))
+        break;
+      ++prefetched_count;
+    }
+
+    static constexpr auto mib_scale = double(1 << 20);
+
+    NOTICE_LOG_FMT(DISCIO,
+                   "CachedBlobReader: Prefetched {:.2f} MiB into a cache of {:.2f} MiB in {:.2f} "
+                   "seconds.",
+                   prefetched_count * CLUSTER_SIZE / mib_scale,
+                   m_slot_count * CLUSTER_SIZE / mib_scale,
+                   DT_s{Clock::now() - start_time}.count());
+  }
+
+  const u64 m_data_size;
+  const size_t m_slot_count;
+
+  Common::LazyMemoryRegion m_memory_region;
+  u8* m_data{};
+
+  DiscScrubber m_scrubber;
+
+  // Protects everything below.
+  std::mutex m_mutex;
+
+  std::vector<Slot> m_slots;
+  std::unordered_map<u64, size_t> m_cluster_slots;
+  size_t m_used_slot_count = 0;
+  size_t m_clock_hand = 0;
+
+  u64 m_hits = 0;
+  u64 m_misses = 0;
+
+  std::atomic_bool m_stop_thread{};
+  std::thread m_thread;
+};
+
 class CachedBlobReader final : public BlobReader
 {
 public:
   explicit CachedBlobReader(std::unique_ptr<BlobReader> reader, bool attempt_to_scrub)
-      : m_cache_filler{std::make_shared<CacheFiller>(reader->CopyReader(), attempt_to_scrub)},
+      : m_cache{std::make_shared<CacheFiller>(reader->CopyReader(), attempt_to_scrub)},
         m_reader{std::move(reader)}
 
   {
     INFO_LOG_FMT(DISCIO, "CachedBlobReader: Created");
   }
 
-  CachedBlobReader(std::shared_ptr<CacheFiller> cache_filler, std::unique_ptr<BlobReader> reader)
-      : m_cache_filler{std::move(cache_filler)}, m_reader{std::move(reader)}
+  CachedBlobReader(std::unique_ptr<BlobReader> reader, bool attempt_to_scrub, u64 size_limit)
+      : m_cache{std::make_shared<ClusterCache>(reader->CopyReader(), attempt_to_scrub, size_limit)},
+        m_reader{std::move(reader)}
+  {
+    INFO_LOG_FMT(DISCIO, "CachedBlobReader: Created with a limit of {} bytes", size_limit);
+  }
+
+  CachedBlobReader(std::shared_ptr<BlobCache> cache, std::unique_ptr<BlobReader> reader)
+      : m_cache{std::move(cache)}, m_reader{std::move(reader)}
   {
     INFO_LOG_FMT(DISCIO, "CachedBlobReader: Copied");
   }
 
   std::unique_ptr<BlobReader> CopyReader() const override
   {
-    return std::make_unique<CachedBlobReader>(m_cache_filler, m_reader->CopyReader());
+    return std::make_unique<CachedBlobReader>(m_cache, m_reader->CopyReader());
   }
 
   BlobType GetBlobType() const override { return m_reader->GetBlobType(); }
@@ -210,18 +476,21 @@ public:
   DataSizeType GetDataSizeType() const override { return m_reader->GetDataSizeType(); }
 
   u64 GetBlockSize() const override { return 0; }
-  bool HasFastRandomAccessInBlock() const override { return true; }
+  bool HasFastRandomAccessInBlock() const override
+  {
+    return m_cache->HasFastRandomAccessInBlock(*m_reader);
+  }
   std::string GetCompressionMethod() const override { return {}; }
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 size, u8* out_ptr) override
   {
-    return m_cache_filler->Read(offset, size, out_ptr) || m_reader->Read(offset, size, out_ptr);
+    return m_cache->Read(offset, size, out_ptr, *m_reader);
   }
 
 private:
   // A shared object does the cache filling for sensible CopyReader behavior.
-  const std::shared_ptr<CacheFiller> m_cache_filler;
+  const std::shared_ptr<BlobCache> m_cache;
 
   const std::unique_ptr<BlobReader> m_reader;
 };
@@ -236,4 +505,10 @@ std::unique_ptr<BlobReader> CreateScrubbingCachedBlobReader(std::unique_ptr<Blob
   return std::make_unique<CachedBlobReader>(std::move(reader), true);
 }
 
+std::unique_ptr<BlobReader> CreateBoundedCachedBlobReader(std::unique_ptr<BlobReader> reader,
+                                                          u64 size_limit)
+{
+  return std::make_unique<CachedBlobReader>(std::move(reader), true, size_limit);
+}
+
 }  // namespace DiscIO
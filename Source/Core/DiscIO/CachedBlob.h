@@ -5,6 +5,7 @@
 
 #include <memory>
 
+#include "Common/CommonTypes.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -13,4 +14,8 @@ namespace DiscIO
 std::unique_ptr<BlobReader> CreateCachedBlobReader(std::unique_ptr<BlobReader> reader);
 std::unique_ptr<BlobReader> CreateScrubbingCachedBlobReader(std::unique_ptr<BlobReader> reader);
 
+// Only keeps up to size_limit bytes in memory, preferring the clusters that are actually read.
+std::unique_ptr<BlobReader> CreateBoundedCachedBlobReader(std::unique_ptr<BlobReader> reader,
+                                                          u64 size_limit);
+
 }  // namespace DiscIO
@@ -272,7 +272,7 @@ static ConversionResultCode Output(OutputParameters parameters, File::DirectIOFi
 
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int block_size,
-                  const CompressCB& callback)
+                  const CompressCB& callback, CompressorPool* compressor_pool)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
 
@@ -324,7 +324,7 @@ bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> compressor(
-      SetUpCompressThreadState, compress, output);
+      SetUpCompressThreadState, compress, output, compressor_pool);
 
   std::vector<u8> in_buf(block_size);
   for (u32 i = 0; i < header.num_blocks; i++)
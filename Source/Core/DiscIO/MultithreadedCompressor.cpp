@@ -0,0 +1,38 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/MultithreadedCompressor.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace DiscIO
+{
+CompressorPool::CompressorPool(size_t thread_count, size_t max_items_in_flight)
+    : m_thread_pool("Compressor", std::max<size_t>(thread_count, 1)),
+      m_max_items_in_flight(std::max<size_t>(max_items_in_flight, 1))
+{
+}
+
+void CompressorPool::AcquireItem()
+{
+  std::unique_lock lk(m_mutex);
+  m_item_released.wait(lk, [this] { return m_items_in_flight < m_max_items_in_flight; });
+  ++m_items_in_flight;
+}
+
+void CompressorPool::ReleaseItem()
+{
+  {
+    std::lock_guard lk(m_mutex);
+    ASSERT(m_items_in_flight != 0);
+    --m_items_in_flight;
+  }
+  m_item_released.notify_one();
+}
+
+size_t CompressorPool::GetDefaultThreadCount()
+{
+  return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+}  // namespace DiscIO
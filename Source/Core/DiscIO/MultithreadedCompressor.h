@@ -4,14 +4,20 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <expected>
 #include <functional>
+#include <map>
 #include <memory>
-#include <thread>
+#include <mutex>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include "Common/Assert.h"
-#include "Common/Event.h"
+#include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
 
 namespace DiscIO
 {
@@ -27,12 +33,48 @@ enum class ConversionResultCode
 template <typename T>
 using ConversionResult = std::expected<T, ConversionResultCode>;
 
-// This class starts a number of compression threads and one output thread.
-// The set_up_compress_thread_state function is called at the start of each compression thread.
+// The threads that MultithreadedCompressors run their work on. A single pool can be shared by
+// several compressors that are in use at the same time, in which case the thread count and the
+// limit on how many items may be in flight apply to all of them together.
+class CompressorPool final
+{
+public:
+  // An item is in flight from the moment it is submitted until it has been output, so
+  // max_items_in_flight bounds how much uncompressed and compressed data is held in memory.
+  CompressorPool(size_t thread_count, size_t max_items_in_flight);
+
+  CompressorPool(const CompressorPool&) = delete;
+  CompressorPool& operator=(const CompressorPool&) = delete;
+  CompressorPool(CompressorPool&&) = delete;
+  CompressorPool& operator=(CompressorPool&&) = delete;
+
+  Common::ThreadPool& GetThreadPool() { return m_thread_pool; }
+  size_t GetThreadCount() const { return m_thread_pool.GetThreadCount(); }
+
+  // Blocks until there is room for another item to be in flight.
+  void AcquireItem();
+  void ReleaseItem();
+
+  // One thread per hardware thread.
+  static size_t GetDefaultThreadCount();
+
+private:
+  Common::ThreadPool m_thread_pool;
+
+  std::mutex m_mutex;
+  std::condition_variable m_item_released;
+  const size_t m_max_items_in_flight;
+  size_t m_items_in_flight = 0;
+};
+
+// This class runs compression work on the threads of a CompressorPool, either one passed to the
+// constructor or one of its own with a thread per hardware thread.
+// Each concurrently running compression task gets a CompressThreadState of its own, which is set
+// up by calling set_up_compress_thread_state before it's first used.
 // When CompressAndWrite is called, the compress function will be called on one of the
-// compression threads, and then the output function will be called on the output thread.
-// The output thread handles data in the order that data was submitted using CompressAndWrite,
-// but the compression threads are not guaranteed to handle data in a predictable order.
+// pool threads, and then the output function will be called on one of the pool threads.
+// Calls to the output function never overlap and handle data in the order that data was submitted
+// using CompressAndWrite, but compression is not guaranteed to happen in a predictable order.
 // Remember to check GetStatus regularly and cancel if it doesn't return Success,
 // and call Shutdown when you want to ensure that everything finishes.
 template <typename CompressThreadState, typename CompressParameters, typename OutputParameters>
@@ -43,44 +85,44 @@ public:
       std::function<ConversionResultCode(CompressThreadState*)> set_up_compress_thread_state,
       std::function<ConversionResult<OutputParameters>(CompressThreadState*, CompressParameters)>
           compress,
-      std::function<ConversionResultCode(OutputParameters)> output)
+      std::function<ConversionResultCode(OutputParameters)> output, CompressorPool* pool = nullptr)
       : m_set_up_compress_thread_state(std::move(set_up_compress_thread_state)),
-        m_compress(std::move(compress)), m_output(std::move(output)),
-        m_threads(std::max<unsigned int>(1, std::thread::hardware_concurrency()))
+        m_compress(std::move(compress)), m_output(std::move(output))
   {
-    m_compress_threads = std::make_unique<CompressThread[]>(m_threads);
-
-    for (size_t i = 0; i < m_threads; ++i)
+    if (!pool)
     {
-      m_compress_threads[i].thread =
-          std::thread(std::mem_fn(&MultithreadedCompressor::CompressThreadFunction), this,
-                      &m_compress_threads[i]);
+      const size_t thread_count = CompressorPool::GetDefaultThreadCount();
+      m_own_pool = std::make_unique<CompressorPool>(thread_count, thread_count * 2);
+      pool = m_own_pool.get();
     }
-
-    m_output_thread =
-        std::thread(std::mem_fn(&MultithreadedCompressor::OutputThreadFunction), this);
+    m_pool = pool;
   }
 
-  ~MultithreadedCompressor()
-  {
-    if (!m_shutting_down.load())
-      Shutdown();
-  }
+  ~MultithreadedCompressor() { Shutdown(); }
 
+  MultithreadedCompressor(const MultithreadedCompressor&) = delete;
+  MultithreadedCompressor& operator=(const MultithreadedCompressor&) = delete;
+  MultithreadedCompressor(MultithreadedCompressor&&) = delete;
+  MultithreadedCompressor& operator=(MultithreadedCompressor&&) = delete;
+
+  // May block until the pool has room for another item.
+  // Must not be called concurrently with itself or with Shutdown.
   void CompressAndWrite(CompressParameters parameters)
   {
     if (GetStatus() != ConversionResultCode::Success)
       return;
 
-    CompressThread& compress_thread = m_compress_threads[m_current_index];
+    m_pool->AcquireItem();
 
-    compress_thread.compress_ready_event.Wait();
-    compress_thread.compress_parameters = std::move(parameters);
-    compress_thread.compress_event.Set();
+    {
+      std::lock_guard lk(m_mutex);
+      ++m_items_in_flight;
+    }
 
-    ++m_current_index;
-    if (m_current_index >= m_threads)
-      m_current_index -= m_threads;
+    const u64 index = m_next_submit_index++;
+    m_pool->GetThreadPool().Push([this, index, parameters = std::move(parameters)]() mutable {
+      CompressItem(index, std::move(parameters));
+    });
   }
 
   void SetError(ConversionResultCode result)
@@ -94,113 +136,103 @@ public:
 
   ConversionResultCode GetStatus() const { return m_result.load(); }
 
+  // Waits until everything that has been submitted has been output (or skipped due to an error).
   void Shutdown()
   {
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].compress_ready_event.Wait();
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].compress_done_event.Wait();
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].output_ready_event.Wait();
-
-    m_shutting_down.store(true);
-
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].compress_event.Set();
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].output_event.Set();
+    std::unique_lock lk(m_mutex);
+    m_items_done.wait(lk, [this] { return m_items_in_flight == 0; });
 
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].thread.join();
-
-    m_output_thread.join();
+    m_idle_states.clear();
   }
 
 private:
-  struct CompressThread
-  {
-    std::thread thread;
-
-    Common::Event compress_ready_event;
-    Common::Event compress_event;
-    Common::Event compress_done_event;
-    Common::Event output_ready_event;
-    Common::Event output_event;
-
-    CompressParameters compress_parameters;
-    OutputParameters output_parameters;
-  };
-
-  void CompressThreadFunction(CompressThread* state)
+  void CompressItem(u64 index, CompressParameters parameters)
   {
-    CompressThreadState compress_thread_state;
-
-    ConversionResultCode setup_result = m_set_up_compress_thread_state(&compress_thread_state);
-    if (setup_result != ConversionResultCode::Success)
-      SetError(setup_result);
+    std::optional<OutputParameters> output_parameters;
 
-    state->compress_ready_event.Set();
-    state->compress_done_event.Set();
-
-    while (true)
+    if (GetStatus() == ConversionResultCode::Success)
     {
-      state->compress_event.Wait();
-
-      if (m_shutting_down.load())
-        return;
+      std::unique_ptr<CompressThreadState> state = AcquireState();
+      if (state)
+      {
+        ConversionResult<OutputParameters> result =
+            m_compress(state.get(), std::move(parameters));
 
-      CompressParameters parameters = std::move(state->compress_parameters);
+        if (result)
+          output_parameters = std::move(*result);
+        else
+          SetError(result.error());
 
-      state->compress_done_event.Reset();
-      state->compress_ready_event.Set();
+        std::lock_guard lk(m_mutex);
+        m_idle_states.push_back(std::move(state));
+      }
+    }
 
-      ConversionResult<OutputParameters> result =
-          m_compress(&compress_thread_state, std::move(parameters));
+    OutputInOrder(index, std::move(output_parameters));
+  }
 
-      if (result)
-      {
-        state->output_ready_event.Wait();
-        state->output_parameters = std::move(*result);
-        state->output_event.Set();
-      }
-      else
+  std::unique_ptr<CompressThreadState> AcquireState()
+  {
+    {
+      std::lock_guard lk(m_mutex);
+      if (!m_idle_states.empty())
       {
-        SetError(result.error());
+        std::unique_ptr<CompressThreadState> state = std::move(m_idle_states.back());
+        m_idle_states.pop_back();
+        return state;
       }
+    }
 
-      state->compress_done_event.Set();
+    auto state = std::make_unique<CompressThreadState>();
+    const ConversionResultCode setup_result = m_set_up_compress_thread_state(state.get());
+    if (setup_result != ConversionResultCode::Success)
+    {
+      SetError(setup_result);
+      return nullptr;
     }
+
+    return state;
   }
 
-  void OutputThreadFunction()
+  // Whichever thread finishes the next item to be output outputs it, along with any later items
+  // that were finished in the meantime. Other threads just leave their results behind.
+  void OutputInOrder(u64 index, std::optional<OutputParameters> output_parameters)
   {
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].output_ready_event.Set();
+    std::unique_lock lk(m_mutex);
+    m_finished_items.emplace(index, std::move(output_parameters));
+    if (m_outputting)
+      return;
 
-    size_t index = 0;
+    m_outputting = true;
 
-    while (true)
+    for (auto it = m_finished_items.find(m_next_output_index); it != m_finished_items.end();
+         it = m_finished_items.find(m_next_output_index))
     {
-      CompressThread& compress_thread = m_compress_threads[index];
-
-      compress_thread.output_event.Wait();
+      std::optional<OutputParameters> parameters = std::move(it->second);
+      m_finished_items.erase(it);
+      ++m_next_output_index;
 
-      if (m_shutting_down.load())
-        return;
+      lk.unlock();
 
-      OutputParameters parameters = std::move(compress_thread.output_parameters);
+      if (parameters && GetStatus() == ConversionResultCode::Success)
+      {
+        const ConversionResultCode result = m_output(std::move(*parameters));
+        if (result != ConversionResultCode::Success)
+          SetError(result);
+      }
 
-      compress_thread.output_ready_event.Set();
+      m_pool->ReleaseItem();
 
-      const ConversionResultCode result = m_output(std::move(parameters));
+      lk.lock();
+      --m_items_in_flight;
+    }
 
-      if (result != ConversionResultCode::Success)
-        SetError(result);
+    m_outputting = false;
 
-      ++index;
-      if (index >= m_threads)
-        index -= m_threads;
-    }
+    // Notify while holding the lock, since Shutdown returning may lead to this object being
+    // destroyed.
+    if (m_items_in_flight == 0)
+      m_items_done.notify_all();
   }
 
   std::function<ConversionResultCode(CompressThreadState*)> m_set_up_compress_thread_state;
@@ -208,15 +240,26 @@ private:
       m_compress;
   std::function<ConversionResultCode(OutputParameters)> m_output;
 
-  // We can't use std::vector for this, because Common::Event is not movable
-  std::unique_ptr<CompressThread[]> m_compress_threads;
-  std::thread m_output_thread;
+  std::unique_ptr<CompressorPool> m_own_pool;
+  CompressorPool* m_pool;
+
+  // Only accessed by the thread calling CompressAndWrite.
+  u64 m_next_submit_index = 0;
+
+  // Protects everything below.
+  std::mutex m_mutex;
+  std::condition_variable m_items_done;
+
+  size_t m_items_in_flight = 0;
+  std::vector<std::unique_ptr<CompressThreadState>> m_idle_states;
 
-  const size_t m_threads;
-  size_t m_current_index = 0;
+  // Items that have been compressed but not yet output, by submission index. Failed items are
+  // stored as std::nullopt so that later items aren't held up by them.
+  std::map<u64, std::optional<OutputParameters>> m_finished_items;
+  u64 m_next_output_index = 0;
+  bool m_outputting = false;
 
   std::atomic<ConversionResultCode> m_result = ConversionResultCode::Success;
-  std::atomic<bool> m_shutting_down = false;
 };
 
 }  // namespace DiscIO
@@ -122,7 +122,15 @@ std::unique_ptr<VolumeDisc> CreateDiscForCore(const std::string& path)
   auto reader = CreateBlobReader(path);
 
   if (Config::Get(Config::MAIN_LOAD_GAME_INTO_MEMORY))
-    return TryCreateDisc(reader, CreateScrubbingCachedBlobReader);
+  {
+    const u64 size_limit = u64(Config::Get(Config::MAIN_LOAD_GAME_INTO_MEMORY_LIMIT)) * 1024 * 1024;
+    if (size_limit == 0)
+      return TryCreateDisc(reader, CreateScrubbingCachedBlobReader);
+
+    return TryCreateDisc(reader, [size_limit](std::unique_ptr<BlobReader> r) {
+      return CreateBoundedCachedBlobReader(std::move(r), size_limit);
+    });
+  }
 
   return TryCreateDisc(reader);
 }
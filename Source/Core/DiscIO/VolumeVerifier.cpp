@@ -4,6 +4,9 @@
 #include "DiscIO/VolumeVerifier.h"
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
 #include <future>
 #include <memory>
 #include <optional>
@@ -361,16 +364,84 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
 
 constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
 
+// How many chunks may have been read without being fully processed yet.
+// This bounds the memory used for chunks that are waiting to be hashed.
+constexpr size_t MAX_CHUNKS_IN_FLIGHT = 8;
+
+// Enough threads for every hash and the integrity checks to run at the same time.
+constexpr size_t DEFAULT_THREAD_COUNT = 4;
+
+class VolumeVerifier::Stage final
+{
+public:
+  explicit Stage(Common::ThreadPool& pool) : m_pool(pool) {}
+
+  ~Stage()
+  {
+    std::unique_lock lk(m_mutex);
+    m_idle.wait(lk, [this] { return !m_scheduled; });
+  }
+
+  void Push(std::function<void()> task)
+  {
+    std::lock_guard lk(m_mutex);
+    m_tasks.emplace_back(std::move(task));
+    if (!m_scheduled)
+    {
+      m_scheduled = true;
+      m_pool.Push([this] { RunTasks(); });
+    }
+  }
+
+private:
+  void RunTasks()
+  {
+    std::unique_lock lk(m_mutex);
+    while (!m_tasks.empty())
+    {
+      std::function<void()> task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+
+      lk.unlock();
+      task();
+      lk.lock();
+    }
+    m_scheduled = false;
+    m_idle.notify_all();
+  }
+
+  Common::ThreadPool& m_pool;
+
+  std::mutex m_mutex;
+  std::condition_variable m_idle;
+  std::deque<std::function<void()>> m_tasks;
+  bool m_scheduled = false;
+};
+
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
-                               Hashes<bool> hashes_to_calculate)
+                               Hashes<bool> hashes_to_calculate, Common::ThreadPool* thread_pool)
     : m_volume(volume), m_redump_verification(redump_verification),
       m_hashes_to_calculate(hashes_to_calculate),
       m_calculating_any_hash(hashes_to_calculate.crc32 || hashes_to_calculate.md5 ||
                              hashes_to_calculate.sha1),
-      m_max_progress(volume.GetDataSize()), m_data_size_type(volume.GetDataSizeType())
+      m_thread_pool(thread_pool), m_max_progress(volume.GetDataSize()),
+      m_data_size_type(volume.GetDataSizeType())
 {
   if (!m_calculating_any_hash)
     m_redump_verification = false;
+
+  if (!m_thread_pool)
+  {
+    m_own_thread_pool =
+        std::make_unique<Common::ThreadPool>("Volume Verifier", DEFAULT_THREAD_COUNT);
+    m_thread_pool = m_own_thread_pool.get();
+  }
+
+  m_crc32_stage = std::make_unique<Stage>(*m_thread_pool);
+  m_md5_stage = std::make_unique<Stage>(*m_thread_pool);
+  m_sha1_stage = std::make_unique<Stage>(*m_thread_pool);
+  m_content_stage = std::make_unique<Stage>(*m_thread_pool);
+  m_group_stage = std::make_unique<Stage>(*m_thread_pool);
 }
 
 VolumeVerifier::~VolumeVerifier()
@@ -1075,27 +1146,27 @@ void VolumeVerifier::SetUpHashing()
   }
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::WaitForChunksInFlight(size_t max_chunks_in_flight)
 {
-  if (m_crc32_future.valid())
-    m_crc32_future.wait();
-  if (m_md5_future.valid())
-    m_md5_future.wait();
-  if (m_sha1_future.valid())
-    m_sha1_future.wait();
-  if (m_content_future.valid())
-    m_content_future.wait();
-  if (m_group_future.valid())
-    m_group_future.wait();
+  std::unique_lock lk(m_chunks_mutex);
+  m_chunk_done.wait(lk, [&] { return m_chunks_in_flight <= max_chunks_in_flight; });
 }
 
-bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
+void VolumeVerifier::WaitForAsyncOperations()
 {
+  WaitForChunksInFlight(0);
+}
+
+bool VolumeVerifier::ReadChunk(u64 bytes_to_read)
+{
+  // Leave room for the chunk that is about to be read.
+  WaitForChunksInFlight(MAX_CHUNKS_IN_FLIGHT - 1);
+
   std::vector<u8> data(bytes_to_read);
 
   const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
   if (bytes_to_copy > 0)
-    std::memcpy(data.data(), m_data.data() + m_data.size() - m_excess_bytes, bytes_to_copy);
+    std::memcpy(data.data(), m_data->data() + m_data->size() - m_excess_bytes, bytes_to_copy);
   bytes_to_read -= bytes_to_copy;
 
   if (bytes_to_read > 0)
@@ -1107,11 +1178,53 @@ bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
     }
   }
 
-  WaitForAsyncOperations();
-  m_data = std::move(data);
+  m_data = std::make_shared<const std::vector<u8>>(std::move(data));
   return true;
 }
 
+void VolumeVerifier::VerifyGroup(const GroupToVerify& group, const u8* data)
+{
+  const size_t block_count = group.block_index_end - group.block_index_start;
+
+  // Not std::vector<bool>, since the elements are written to from multiple threads
+  std::vector<u8> blocks_valid(block_count);
+  if (data && block_count > 0)
+  {
+    const auto check_block = [&](size_t i) {
+      blocks_valid[i] = m_volume.CheckBlockIntegrity(
+          group.block_index_start + i, data + i * VolumeWii::BLOCK_TOTAL_SIZE, group.partition);
+    };
+
+    // The first check lazily sets up the partition's key and H3 table, which isn't thread-safe.
+    check_block(0);
+    m_thread_pool->ParallelFor(block_count - 1, [&](size_t i) { check_block(i + 1); });
+  }
+
+  for (size_t i = 0; i < block_count; ++i)
+  {
+    const u64 block_offset = group.offset + i * VolumeWii::BLOCK_TOTAL_SIZE;
+
+    if (blocks_valid[i])
+    {
+      m_biggest_verified_offset =
+          std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        m_unused_block_errors[group.partition]++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        m_block_errors[group.partition]++;
+      }
+    }
+  }
+}
+
 void VolumeVerifier::Process()
 {
   ASSERT(m_started);
@@ -1183,7 +1296,7 @@ void VolumeVerifier::Process()
   }
 
   const bool is_data_needed = m_calculating_any_hash || content_read || group_read;
-  const bool read_failed = is_data_needed && !ReadChunkAndWaitForAsyncOperations(bytes_to_read);
+  const bool read_failed = is_data_needed && !ReadChunk(bytes_to_read);
 
   if (read_failed)
   {
@@ -1196,38 +1309,74 @@ void VolumeVerifier::Process()
   m_excess_bytes = excess_bytes;
   const u64 byte_increment = bytes_to_read - excess_bytes;
 
+  size_t task_count = content_read + group_read;
+  if (m_calculating_any_hash)
+  {
+    task_count += m_hashes_to_calculate.crc32 + m_hashes_to_calculate.md5 +
+                  m_hashes_to_calculate.sha1;
+  }
+
+  if (task_count == 0)
+  {
+    m_progress += byte_increment;
+    return;
+  }
+
+  {
+    std::lock_guard lk(m_chunks_mutex);
+    ++m_chunks_in_flight;
+  }
+
+  // Every task calls this once it's done, and the last one marks the chunk as done.
+  const auto remaining_tasks = std::make_shared<std::atomic<size_t>>(task_count);
+  const auto task_done = [this, remaining_tasks] {
+    if (--*remaining_tasks != 0)
+      return;
+
+    std::lock_guard lk(m_chunks_mutex);
+    --m_chunks_in_flight;
+    m_chunk_done.notify_all();
+  };
+
+  // The tasks keep the chunk alive, since m_data gets replaced by the next read.
+  const std::shared_ptr<const std::vector<u8>> data = m_data;
+
   if (m_calculating_any_hash)
   {
     if (m_hashes_to_calculate.crc32)
     {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
-        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
-                                              static_cast<size_t>(byte_increment));
+      m_crc32_stage->Push([this, data, byte_increment, task_done] {
+        m_crc32_context =
+            Common::UpdateCRC32(m_crc32_context, data->data(), static_cast<size_t>(byte_increment));
+        task_done();
       });
     }
 
     if (m_hashes_to_calculate.md5)
     {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
-        mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
+      m_md5_stage->Push([this, data, byte_increment, task_done] {
+        mbedtls_md5_update_ret(&m_md5_context, data->data(), byte_increment);
+        task_done();
       });
     }
 
     if (m_hashes_to_calculate.sha1)
     {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
-        m_sha1_context->Update(m_data.data(), byte_increment);
+      m_sha1_stage->Push([this, data, byte_increment, task_done] {
+        m_sha1_context->Update(data->data(), byte_increment);
+        task_done();
       });
     }
   }
 
   if (content_read)
   {
-    m_content_future = std::async(std::launch::async, [this, read_failed, content] {
-      if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
+    m_content_stage->Push([this, data, read_failed, content, task_done] {
+      if (read_failed || !m_volume.CheckContentIntegrity(content, *data, m_ticket))
       {
         AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
       }
+      task_done();
     });
 
     m_content_index++;
@@ -1235,35 +1384,9 @@ void VolumeVerifier::Process()
 
   if (group_read)
   {
-    m_group_future = std::async(std::launch::async, [this, read_failed,
-                                                     group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
-
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
-      }
+    m_group_stage->Push([this, data, read_failed, group_index = m_group_index, task_done] {
+      VerifyGroup(m_groups[group_index], read_failed ? nullptr : data->data());
+      task_done();
     });
 
     m_group_index++;
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -14,6 +16,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/ThreadPool.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -29,6 +32,10 @@
 //
 // Start, Process and Finish may take some time to run.
 //
+// Reading happens on the thread calling Process, while hashing and integrity checks of the data
+// that has been read run on a thread pool. A pool can be shared between several verifiers to
+// verify multiple volumes at once without oversubscribing the CPU.
+//
 // GetResult() can be called before the processing is finished, but the result will be incomplete.
 
 namespace DiscIO
@@ -124,7 +131,9 @@ public:
     RedumpVerifier::Result redump;
   };
 
-  VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate);
+  // If thread_pool is nullptr, the verifier creates a pool of its own.
+  VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate,
+                 Common::ThreadPool* thread_pool = nullptr);
   ~VolumeVerifier();
 
   static Hashes<bool> GetDefaultHashesToCalculate();
@@ -136,6 +145,8 @@ public:
   const Result& GetResult() const;
 
 private:
+  class Stage;
+
   struct GroupToVerify
   {
     Partition partition;
@@ -156,8 +167,11 @@ private:
   void CheckMisc();
   void CheckSuperPaperMario();
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
-  bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  void WaitForChunksInFlight(size_t max_chunks_in_flight);
+  void WaitForAsyncOperations();
+  bool ReadChunk(u64 bytes_to_read);
+  // data is nullptr if the group couldn't be read.
+  void VerifyGroup(const GroupToVerify& group, const u8* data);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -179,13 +193,23 @@ private:
   mbedtls_md5_context m_md5_context{};
   std::unique_ptr<Common::SHA1::Context> m_sha1_context;
 
+  std::unique_ptr<Common::ThreadPool> m_own_thread_pool;
+  Common::ThreadPool* m_thread_pool;
+
+  // Each kind of work runs in order on its own stage, so up to one task per stage runs at a time.
+  std::unique_ptr<Stage> m_crc32_stage;
+  std::unique_ptr<Stage> m_md5_stage;
+  std::unique_ptr<Stage> m_sha1_stage;
+  std::unique_ptr<Stage> m_content_stage;
+  std::unique_ptr<Stage> m_group_stage;
+
+  // Chunks that have been read but still have work pending on them.
+  size_t m_chunks_in_flight = 0;
+  std::mutex m_chunks_mutex;
+  std::condition_variable m_chunk_done;
+
   u64 m_excess_bytes = 0;
-  std::vector<u8> m_data;
-  std::future<void> m_crc32_future;
-  std::future<void> m_md5_future;
-  std::future<void> m_sha1_future;
-  std::future<void> m_content_future;
-  std::future<void> m_group_future;
+  std::shared_ptr<const std::vector<u8>> m_data;
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
@@ -86,7 +86,14 @@ WIARVZFileReader<RVZ>::WIARVZFileReader(File::DirectIOFile file, const std::stri
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  if (m_decompression_pool)
+  {
+    m_decompression_pool->Cancel();
+    m_decompression_pool->Shutdown();
+  }
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -210,11 +217,11 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
 
   const u32 number_of_raw_data_entries = Common::swap32(m_header_2.number_of_raw_data_entries);
   m_raw_data_entries.resize(number_of_raw_data_entries);
-  Chunk& raw_data_entries =
-      ReadCompressedData(Common::swap64(m_header_2.raw_data_entries_offset),
-                         Common::swap32(m_header_2.raw_data_entries_size),
-                         number_of_raw_data_entries * sizeof(RawDataEntry), m_compression_type);
-  if (!raw_data_entries.ReadAll(&m_raw_data_entries))
+  const std::shared_ptr<Chunk> raw_data_entries =
+      CreateChunk(Common::swap64(m_header_2.raw_data_entries_offset),
+                  Common::swap32(m_header_2.raw_data_entries_size),
+                  number_of_raw_data_entries * sizeof(RawDataEntry), m_compression_type, 0, 0, 0);
+  if (!raw_data_entries->ReadAll(&m_raw_data_entries))
     return false;
 
   for (size_t i = 0; i < m_raw_data_entries.size(); ++i)
@@ -227,11 +234,11 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
 
   const u32 number_of_group_entries = Common::swap32(m_header_2.number_of_group_entries);
   m_group_entries.resize(number_of_group_entries);
-  Chunk& group_entries =
-      ReadCompressedData(Common::swap64(m_header_2.group_entries_offset),
-                         Common::swap32(m_header_2.group_entries_size),
-                         number_of_group_entries * sizeof(GroupEntry), m_compression_type);
-  if (!group_entries.ReadAll(&m_group_entries))
+  const std::shared_ptr<Chunk> group_entries =
+      CreateChunk(Common::swap64(m_header_2.group_entries_offset),
+                  Common::swap32(m_header_2.group_entries_size),
+                  number_of_group_entries * sizeof(GroupEntry), m_compression_type, 0, 0, 0);
+  if (!group_entries->ReadAll(&m_group_entries))
     return false;
 
   if (HasDataOverlap())
@@ -511,42 +518,28 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     if (total_group_index >= m_group_entries.size())
       return false;
 
-    const GroupEntry group = m_group_entries[total_group_index];
     const u64 group_offset_in_data = i * chunk_size;
     const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
 
-    chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
+    const GroupChunk group =
+        GetGroupChunk(m_group_entries[total_group_index], chunk_size, data_size,
+                      group_offset_in_data);
 
-    const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
+    const u64 bytes_to_read = std::min(group.decompressed_size - offset_in_group, *size);
 
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
-
-    if (group_data_size == 0)
+    if (group.compressed_size == 0)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+      const std::shared_ptr<Chunk> chunk = ReadCompressedData(
+          group.offset_in_file, group.compressed_size, group.decompressed_size,
+          group.compression_type, exception_lists, group.rvz_packed_size, group_offset_in_data);
 
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
-
-      if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
+      if (!chunk->Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        InvalidateCachedChunk(group.offset_in_file);
         return false;
       }
 
@@ -556,11 +549,21 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
         const u16 additional_offset =
             static_cast<u16>(group_offset_in_data % VolumeWii::GROUP_DATA_SIZE /
                              VolumeWii::BLOCK_DATA_SIZE * VolumeWii::BLOCK_HEADER_SIZE);
-        chunk.GetHashExceptions(&m_exception_list, exception_list_index, additional_offset);
+        chunk->GetHashExceptions(&m_exception_list, exception_list_index, additional_offset);
         m_exception_list_last_group_index = total_group_index;
       }
     }
 
+    if (m_last_group_read != total_group_index)
+    {
+      // Once a read has moved on from one group to the one after it, assume that the ones after
+      // that will be needed soon too.
+      if (m_last_group_read + 1 == total_group_index)
+        PrefetchGroups(chunk_size, data_size, group_index, number_of_groups, i + 1,
+                       exception_lists);
+      m_last_group_read = total_group_index;
+    }
+
     *offset += bytes_to_read;
     *size -= bytes_to_read;
     *out_ptr += bytes_to_read;
@@ -570,15 +573,133 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
 }
 
 template <bool RVZ>
-typename WIARVZFileReader<RVZ>::Chunk&
+typename WIARVZFileReader<RVZ>::GroupChunk
+WIARVZFileReader<RVZ>::GetGroupChunk(const GroupEntry& group, u64 chunk_size, u64 data_size,
+                                     u64 group_offset_in_data) const
+{
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  WIARVZCompressionType compression_type = m_compression_type;
+  u32 rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      compression_type = WIARVZCompressionType::None;
+
+    group_data_size &= 0x7FFFFFFF;
+
+    rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  return GroupChunk{static_cast<u64>(Common::swap32(group.data_offset)) << 2,
+                    group_data_size,
+                    std::min(chunk_size, data_size - group_offset_in_data),
+                    compression_type,
+                    rvz_packed_size,
+                    group_offset_in_data};
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::PrefetchGroups(u64 chunk_size, u64 data_size, u32 group_index,
+                                           u32 number_of_groups, u64 next_group,
+                                           u32 exception_lists)
+{
+  if (!m_decompression_pool)
+  {
+    const size_t thread_count =
+        std::min(Common::ThreadPool::GetDefaultThreadCount(), MAX_DECOMPRESSION_THREADS);
+    if (thread_count == 0)
+      return;
+
+    m_decompression_pool = std::make_unique<Common::ThreadPool>("WIA/RVZ Decompression",
+                                                                thread_count);
+  }
+
+  const u64 end_group = std::min<u64>(number_of_groups, next_group + PREFETCH_GROUPS);
+  for (u64 i = next_group; i < end_group; ++i)
+  {
+    const u64 total_group_index = group_index + i;
+    if (total_group_index >= m_group_entries.size())
+      return;
+
+    const u64 group_offset_in_data = i * chunk_size;
+    const GroupChunk group = GetGroupChunk(m_group_entries[total_group_index], chunk_size,
+                                           data_size, group_offset_in_data);
+
+    // Nothing to gain from reading uncompressed data on another thread
+    if (group.compressed_size == 0 || group.compression_type == WIARVZCompressionType::None)
+      continue;
+
+    {
+      std::lock_guard lk(m_chunk_cache_mutex);
+      if (m_cached_chunks.contains(group.offset_in_file))
+        continue;
+    }
+
+    std::shared_ptr<Chunk> chunk = CreateChunk(
+        group.offset_in_file, group.compressed_size, group.decompressed_size,
+        group.compression_type, exception_lists, group.rvz_packed_size, group_offset_in_data);
+    InsertCachedChunk(group.offset_in_file, chunk, true);
+
+    m_decompression_pool->Push([this, chunk = std::move(chunk), offset = group.offset_in_file] {
+      const bool success = chunk->DecompressAll();
+
+      {
+        std::lock_guard lk(m_chunk_cache_mutex);
+        const auto it = m_cached_chunks.find(offset);
+        if (it != m_cached_chunks.end() && it->second.chunk == chunk)
+        {
+          if (success)
+            it->second.decompressing = false;
+          else
+            m_cached_chunks.erase(it);
+        }
+      }
+
+      m_chunk_decompressed.notify_all();
+    });
+  }
+}
+
+template <bool RVZ>
+std::shared_ptr<typename WIARVZFileReader<RVZ>::Chunk>
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
                                           u64 decompressed_size,
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  {
+    std::unique_lock lk(m_chunk_cache_mutex);
 
+    auto it = m_cached_chunks.find(offset_in_file);
+    if (it != m_cached_chunks.end() && it->second.decompressing)
+    {
+      m_chunk_decompressed.wait(lk, [&] {
+        it = m_cached_chunks.find(offset_in_file);
+        return it == m_cached_chunks.end() || !it->second.decompressing;
+      });
+    }
+
+    if (it != m_cached_chunks.end())
+    {
+      it->second.last_used = ++m_chunk_use_counter;
+      return it->second.chunk;
+    }
+  }
+
+  std::shared_ptr<Chunk> chunk =
+      CreateChunk(offset_in_file, compressed_size, decompressed_size, compression_type,
+                  exception_lists, rvz_packed_size, data_offset);
+  InsertCachedChunk(offset_in_file, chunk, false);
+  return chunk;
+}
+
+template <bool RVZ>
+std::shared_ptr<typename WIARVZFileReader<RVZ>::Chunk>
+WIARVZFileReader<RVZ>::CreateChunk(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
+                                   WIARVZCompressionType compression_type, u32 exception_lists,
+                                   u32 rvz_packed_size, u64 data_offset)
+{
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
   {
@@ -607,11 +728,47 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return std::make_shared<Chunk>(&m_file, offset_in_file, compressed_size, decompressed_size,
+                                 exception_lists, compressed_exception_lists, rvz_packed_size,
+                                 data_offset, std::move(decompressor));
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InsertCachedChunk(u64 offset_in_file, std::shared_ptr<Chunk> chunk,
+                                              bool decompressing)
+{
+  std::lock_guard lk(m_chunk_cache_mutex);
+
+  while (m_cached_chunks.size() >= CACHED_CHUNKS)
+  {
+    // Chunks that are being decompressed can't be evicted, but there are always few enough of
+    // those that something else can be.
+    auto victim = m_cached_chunks.end();
+    for (auto it = m_cached_chunks.begin(); it != m_cached_chunks.end(); ++it)
+    {
+      if (!it->second.decompressing &&
+          (victim == m_cached_chunks.end() || it->second.last_used < victim->second.last_used))
+      {
+        victim = it;
+      }
+    }
+
+    if (victim == m_cached_chunks.end())
+      break;
+
+    m_cached_chunks.erase(victim);
+  }
+
+  m_cached_chunks.insert_or_assign(offset_in_file,
+                                   CachedChunk{std::move(chunk), ++m_chunk_use_counter,
+                                               decompressing});
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InvalidateCachedChunk(u64 offset_in_file)
+{
+  std::lock_guard lk(m_chunk_cache_mutex);
+  m_cached_chunks.erase(offset_in_file);
 }
 
 template <bool RVZ>
@@ -655,16 +812,29 @@ WIARVZFileReader<RVZ>::Chunk::Chunk(File::DirectIOFile* file, u64 offset_in_file
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 {
-  if (!m_decompressor || !m_file ||
-      offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
-  {
+  if (!DecompressUpTo(offset + size))
+    return false;
+
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  return DecompressUpTo(m_out.data.size() - m_out_bytes_allocated_for_exceptions);
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUpTo(u64 end)
+{
+  if (!m_decompressor || !m_file || end > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
     return false;
-  }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  while (end > GetOutBytesWrittenExcludingExceptions())
   {
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end == m_out.data.size())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -677,7 +847,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -755,7 +925,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -1743,7 +1912,8 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::DirectIOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, CompressCB callback,
+                               CompressorPool* compressor_pool)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
@@ -1850,7 +2020,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> mt_compressor(
-      set_up_compress_thread_state, process_and_compress, output);
+      set_up_compress_thread_state, process_and_compress, output, compressor_pool);
 
   for (const DataEntry& data_entry : data_entries)
   {
@@ -2042,7 +2212,8 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, const CompressCB& callback)
+                       int chunk_size, const CompressCB& callback,
+                       CompressorPool* compressor_pool)
 {
   File::DirectIOFile outfile(outfile_path, File::AccessMode::Write);
   if (!outfile.IsOpen())
@@ -2060,7 +2231,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, callback, compressor_pool);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
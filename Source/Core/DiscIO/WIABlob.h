@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
@@ -15,6 +16,7 @@
 #include "Common/Crypto/SHA1.h"
 #include "Common/DirectIOFile.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -57,6 +59,7 @@ public:
 
   u64 GetBlockSize() const override { return Common::swap32(m_header_2.chunk_size); }
   bool HasFastRandomAccessInBlock() const override { return false; }
+  bool PrefetchesSequentialReads() const override { return true; }
   std::string GetCompressionMethod() const override;
   std::optional<int> GetCompressionLevel() const override
   {
@@ -70,7 +73,8 @@ public:
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::DirectIOFile* outfile,
                                       WIARVZCompressionType compression_type, int compression_level,
-                                      int chunk_size, CompressCB callback);
+                                      int chunk_size, CompressCB callback,
+                                      CompressorPool* compressor_pool = nullptr);
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -195,6 +199,9 @@ private:
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
 
+    // Decompresses the whole chunk ahead of time, so that later reads are just copies.
+    bool DecompressAll();
+
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
                            u64 exception_list_index, u16 additional_offset) const;
@@ -206,6 +213,7 @@ private:
     }
 
   private:
+    bool DecompressUpTo(u64 end);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
@@ -235,12 +243,34 @@ private:
 
   const PartitionEntry* GetPartition(u64 partition_data_offset, u32* partition_first_sector) const;
 
+  // The parameters needed to decompress one group.
+  struct GroupChunk
+  {
+    u64 offset_in_file;
+    u32 compressed_size;
+    u64 decompressed_size;
+    WIARVZCompressionType compression_type;
+    u32 rvz_packed_size;
+    u64 group_offset_in_data;
+  };
+
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
-  Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
-                            WIARVZCompressionType compression_type, u32 exception_lists = 0,
-                            u32 rvz_packed_size = 0, u64 data_offset = 0);
+  GroupChunk GetGroupChunk(const GroupEntry& group, u64 chunk_size, u64 data_size,
+                           u64 group_offset_in_data) const;
+  void PrefetchGroups(u64 chunk_size, u64 data_size, u32 group_index, u32 number_of_groups,
+                      u64 next_group, u32 exception_lists);
+  std::shared_ptr<Chunk> ReadCompressedData(u64 offset_in_file, u64 compressed_size,
+                                             u64 decompressed_size,
+                                             WIARVZCompressionType compression_type,
+                                             u32 exception_lists = 0, u32 rvz_packed_size = 0,
+                                             u64 data_offset = 0);
+  std::shared_ptr<Chunk> CreateChunk(u64 offset_in_file, u64 compressed_size,
+                                     u64 decompressed_size, WIARVZCompressionType compression_type,
+                                     u32 exception_lists, u32 rvz_packed_size, u64 data_offset);
+  void InsertCachedChunk(u64 offset_in_file, std::shared_ptr<Chunk> chunk, bool decompressing);
+  void InvalidateCachedChunk(u64 offset_in_file);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -368,10 +398,33 @@ private:
 
   File::DirectIOFile m_file;
   std::string m_path;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
   WiiEncryptionCache m_encryption_cache;
 
+  struct CachedChunk
+  {
+    std::shared_ptr<Chunk> chunk;
+    u64 last_used = 0;
+    // Set while a worker thread is decompressing the chunk. Nobody else may touch it meanwhile.
+    bool decompressing = false;
+  };
+
+  // Recently used and prefetched chunks, keyed by their offset in the file.
+  // m_chunk_cache_mutex is only needed because of the decompression threads.
+  std::map<u64, CachedChunk> m_cached_chunks;
+  u64 m_chunk_use_counter = 0;
+  std::mutex m_chunk_cache_mutex;
+  std::condition_variable m_chunk_decompressed;
+
+  // Used for detecting sequential reads.
+  u64 m_last_group_read = std::numeric_limits<u64>::max();
+
+  // Only started once reads turn out to be sequential.
+  std::unique_ptr<Common::ThreadPool> m_decompression_pool;
+
+  static constexpr size_t MAX_DECOMPRESSION_THREADS = 4;
+  static constexpr u64 PREFETCH_GROUPS = 8;
+  static constexpr size_t CACHED_CHUNKS = PREFETCH_GROUPS * 2;
+
   std::vector<HashExceptionEntry> m_exception_list;
   bool m_write_to_exception_list = false;
   u64 m_exception_list_last_group_index;
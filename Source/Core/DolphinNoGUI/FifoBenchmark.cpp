@@ -0,0 +1,162 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/FifoBenchmark.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <string_view>
+#include <utility>
+
+#include <picojson.h>
+
+#include "Common/Config/Config.h"
+#include "Common/JsonUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/System.h"
+
+namespace
+{
+constexpr std::array<std::pair<StageProfiler::Stage, std::string_view>, 4> STAGE_NAMES{{
+    {StageProfiler::Stage::OpcodeDecoder, "opcode_decoder_ms"},
+    {StageProfiler::Stage::VertexLoader, "vertex_loader_ms"},
+    {StageProfiler::Stage::TextureDecode, "texture_decode_ms"},
+    {StageProfiler::Stage::ShaderUid, "shader_uid_ms"},
+}};
+
+double ToMilliseconds(std::chrono::nanoseconds time)
+{
+  return std::chrono::duration<double, std::milli>(time).count();
+}
+}  // namespace
+
+FifoBenchmark::FifoBenchmark(Core::System& system, u32 loops) : m_system(system), m_loops(loops)
+{
+  // Measure how fast the log can be played, not how fast the emulated console would have run it.
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+  // Frames are split on the CPU thread while the stages are timed on the GPU thread, so the times
+  // would only line up with their frames if both run on the same thread.
+  Config::SetCurrent(Config::MAIN_CPU_THREAD, false);
+
+  FifoPlayer& fifo_player = m_system.GetFifoPlayer();
+  fifo_player.SetLoopLimit(loops);
+  fifo_player.SetFrameWrittenCallback([this] { OnFrameStart(); });
+
+  StageProfiler::SetEnabled(true);
+}
+
+FifoBenchmark::~FifoBenchmark()
+{
+  StageProfiler::SetEnabled(false);
+
+  FifoPlayer& fifo_player = m_system.GetFifoPlayer();
+  fifo_player.SetFrameWrittenCallback({});
+  fifo_player.SetLoopLimit(0);
+}
+
+void FifoBenchmark::OnFrameStart()
+{
+  if (m_running)
+  {
+    EndFrame();
+  }
+  else
+  {
+    const FifoPlayer& fifo_player = m_system.GetFifoPlayer();
+    m_frames_per_loop = fifo_player.GetFrameRangeEnd() - fifo_player.GetFrameRangeStart() + 1;
+    m_frames.reserve(static_cast<size_t>(m_frames_per_loop) * m_loops);
+    m_running = true;
+  }
+
+  // Anything measured before the first frame belongs to loading the log.
+  StageProfiler::TakeTotals();
+  m_frame_start = std::chrono::steady_clock::now();
+}
+
+void FifoBenchmark::EndFrame()
+{
+  const std::chrono::nanoseconds time = std::chrono::steady_clock::now() - m_frame_start;
+  m_frames.push_back(Frame{time, StageProfiler::TakeTotals()});
+}
+
+void FifoBenchmark::Finish()
+{
+  if (!m_running)
+    return;
+
+  EndFrame();
+  m_running = false;
+}
+
+bool FifoBenchmark::WriteReport(const std::string& path) const
+{
+  picojson::array frames;
+  for (size_t i = 0; i < m_frames.size(); ++i)
+  {
+    const Frame& frame = m_frames[i];
+
+    picojson::object entry;
+    entry.emplace("loop", static_cast<double>(i / m_frames_per_loop));
+    entry.emplace("frame", static_cast<double>(i % m_frames_per_loop));
+    entry.emplace("frame_time_ms", ToMilliseconds(frame.time));
+    for (const auto& [stage, name] : STAGE_NAMES)
+      entry.emplace(std::string(name), ToMilliseconds(frame.totals.time[stage]));
+    entry.emplace("rasterized_pixels", static_cast<double>(frame.totals.rasterized_pixels));
+    frames.emplace_back(std::move(entry));
+  }
+
+  // The first loop fills the caches, so leave it out of the summary unless it's all there is.
+  const size_t first_frame = m_frames.size() > m_frames_per_loop ? m_frames_per_loop : 0;
+  const size_t frame_count = m_frames.size() - first_frame;
+
+  std::chrono::nanoseconds total_time{};
+  std::chrono::nanoseconds min_time = std::chrono::nanoseconds::max();
+  std::chrono::nanoseconds max_time{};
+  StageProfiler::Totals totals;
+  for (size_t i = first_frame; i < m_frames.size(); ++i)
+  {
+    const Frame& frame = m_frames[i];
+    total_time += frame.time;
+    min_time = std::min(min_time, frame.time);
+    max_time = std::max(max_time, frame.time);
+    for (const auto& [stage, name] : STAGE_NAMES)
+      totals.time[stage] += frame.totals.time[stage];
+    totals.rasterized_pixels += frame.totals.rasterized_pixels;
+  }
+
+  picojson::object summary;
+  summary.emplace("frames", static_cast<double>(frame_count));
+  if (frame_count != 0)
+  {
+    summary.emplace("mean_frame_time_ms", ToMilliseconds(total_time) / frame_count);
+    summary.emplace("min_frame_time_ms", ToMilliseconds(min_time));
+    summary.emplace("max_frame_time_ms", ToMilliseconds(max_time));
+    for (const auto& [stage, name] : STAGE_NAMES)
+    {
+      summary.emplace("mean_" + std::string(name),
+                      ToMilliseconds(totals.time[stage]) / frame_count);
+    }
+    summary.emplace("frames_per_second", frame_count / (ToMilliseconds(total_time) / 1000));
+    summary.emplace("rasterized_pixels_per_second",
+                    totals.rasterized_pixels / (ToMilliseconds(total_time) / 1000));
+  }
+
+  picojson::object root;
+  root.emplace("video_backend", Config::Get(Config::MAIN_GFX_BACKEND));
+  root.emplace("dual_core", Config::Get(Config::MAIN_CPU_THREAD));
+  root.emplace("loops", static_cast<double>(m_loops));
+  root.emplace("frames_per_loop", static_cast<double>(m_frames_per_loop));
+  root.emplace("summary", std::move(summary));
+  root.emplace("frames", std::move(frames));
+
+  if (path == "-")
+  {
+    std::fputs(picojson::value(root).serialize(true).c_str(), stdout);
+    return true;
+  }
+
+  return JsonToFile(path, picojson::value(root), true);
+}
@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/StageProfiler.h"
+
+namespace Core
+{
+class System;
+}
+
+// Plays a FIFO log a fixed number of times as fast as possible, and reports how long each frame
+// took and how much of that time was spent in the stages measured by StageProfiler.
+// Dual core is turned off while benchmarking, so that each frame's stage times are measured on the
+// same thread that splits the frames.
+class FifoBenchmark
+{
+public:
+  FifoBenchmark(Core::System& system, u32 loops);
+  FifoBenchmark(const FifoBenchmark&) = delete;
+  FifoBenchmark& operator=(const FifoBenchmark&) = delete;
+  ~FifoBenchmark();
+
+  // Must be called on the CPU thread when playback stops, before the emulated GPU is shut down.
+  void Finish();
+
+  // Writes the results as JSON to the given file, or to stdout if the path is "-".
+  bool WriteReport(const std::string& path) const;
+
+private:
+  struct Frame
+  {
+    std::chrono::nanoseconds time;
+    StageProfiler::Totals totals;
+  };
+
+  void OnFrameStart();
+  void EndFrame();
+
+  Core::System& m_system;
+  u32 m_loops;
+  u32 m_frames_per_loop = 0;
+  std::vector<Frame> m_frames;
+
+  bool m_running = false;
+  std::chrono::steady_clock::time_point m_frame_start;
+};
@@ -6,7 +6,9 @@
 #include <OptionParser.h>
 #include <csignal>
 #include <cstdio>
+#include <memory>
 #include <string>
+#include <variant>
 #include <vector>
 
 #ifndef _WIN32
@@ -22,6 +24,7 @@
 #include "Core/DolphinAnalytics.h"
 #include "Core/Host.h"
 #include "Core/System.h"
+#include "DolphinNoGUI/FifoBenchmark.h"
 
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
@@ -30,6 +33,7 @@
 #include "UICommon/UICommon.h"
 
 static std::unique_ptr<Platform> s_platform;
+static std::unique_ptr<FifoBenchmark> s_fifo_benchmark;
 
 static void signal_handler(int)
 {
@@ -66,7 +70,11 @@ bool Host_UIBlocksControllerState()
 void Host_Message(const HostMessageID id)
 {
   if (id == HostMessageID::WMUserStop)
+  {
+    if (s_fifo_benchmark)
+      s_fifo_benchmark->Finish();
     s_platform->Stop();
+  }
 }
 
 void Host_UpdateTitle(const std::string& title)
@@ -209,6 +217,17 @@ int main(const int argc, char* argv[])
                 "macos"
 #endif
       });
+  parser->add_option("--fifo_benchmark")
+      .action("store")
+      .type("int")
+      .metavar("<loops>")
+      .help("Play the given FIFO log this many times as fast as possible and report the time "
+            "spent on each frame");
+  parser->add_option("--benchmark_output")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Write the FIFO benchmark report as JSON to this file instead of stdout");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -255,6 +274,18 @@ int main(const int argc, char* argv[])
     return 0;
   }
 
+  int fifo_benchmark_loops = 0;
+  if (options.is_set("fifo_benchmark"))
+  {
+    fifo_benchmark_loops = static_cast<int>(options.get("fifo_benchmark"));
+    if (fifo_benchmark_loops <= 0 ||
+        !std::holds_alternative<BootParameters::DFF>(boot->parameters))
+    {
+      fprintf(stderr, "--fifo_benchmark requires a positive loop count and a FIFO log to play.\n");
+      return 1;
+    }
+  }
+
   std::string user_directory;
   if (options.is_set("user"))
     user_directory = static_cast<const char*>(options.get("user"));
@@ -273,10 +304,19 @@ int main(const int argc, char* argv[])
   UICommon::InitControllers(wsi);
 
   Common::ScopeGuard ui_common_guard([] {
+    s_fifo_benchmark.reset();
     UICommon::ShutdownControllers();
     UICommon::Shutdown();
   });
 
+  // The benchmark overrides some settings in the CurrentRun layer, which only exists once the
+  // config has been initialized.
+  if (fifo_benchmark_loops > 0)
+  {
+    s_fifo_benchmark =
+        std::make_unique<FifoBenchmark>(Core::System::GetInstance(), fifo_benchmark_loops);
+  }
+
   if (save_state_path && !game_specified)
   {
     fprintf(stderr, "A save state cannot be loaded without specifying a game to launch.\n");
@@ -319,6 +359,20 @@ int main(const int argc, char* argv[])
   Core::Shutdown(Core::System::GetInstance());
   s_platform.reset();
 
+  if (s_fifo_benchmark)
+  {
+    const std::string output = options.is_set("benchmark_output") ?
+                                   static_cast<const char*>(options.get("benchmark_output")) :
+                                   "-";
+    const bool written = s_fifo_benchmark->WriteReport(output);
+    s_fifo_benchmark.reset();
+    if (!written)
+    {
+      fprintf(stderr, "Could not write the benchmark report to %s\n", output.c_str());
+      return 1;
+    }
+  }
+
   return 0;
 }
 
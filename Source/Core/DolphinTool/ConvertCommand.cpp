@@ -3,21 +3,35 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <list>
+#include <mutex>
 #include <optional>
+#include <set>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
+#include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/ScrubbedBlob.h"
 #include "DiscIO/Volume.h"
+#include "DiscIO/VolumeWii.h"
 #include "DiscIO/WIABlob.h"
 #include "UICommon/UICommon.h"
 
@@ -54,6 +68,180 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
   return std::nullopt;
 }
 
+static std::string_view GetFormatExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  default:
+    return ".iso";
+  }
+}
+
+namespace
+{
+struct ConvertOptions
+{
+  DiscIO::BlobType format = DiscIO::BlobType::RVZ;
+  bool scrub = false;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+  // Whether messages are labeled with the path of the file they belong to
+  bool label_output = false;
+};
+
+struct ConvertResult
+{
+  bool success = false;
+  std::string messages;
+  u64 input_size = 0;
+  u64 output_size = 0;
+  double seconds = 0;
+};
+}  // namespace
+
+static ConvertResult ConvertFile(const std::string& input_file_path,
+                                 const std::string& output_file_path,
+                                 const ConvertOptions& options,
+                                 DiscIO::CompressorPool& compressor_pool)
+{
+  ConvertResult convert_result;
+  const std::string label = options.label_output ? fmt::format("{}: ", input_file_path) : "";
+  const auto error = [&](std::string_view message) {
+    convert_result.messages += fmt::format("Error: {}{}\n", label, message);
+    return convert_result;
+  };
+  const auto warning = [&](std::string_view message) {
+    convert_result.messages += fmt::format("Warning: {}{}\n", label, message);
+  };
+
+  const DiscIO::BlobType format = options.format;
+
+  if (input_file_path == output_file_path)
+    return error("The output path is the same as the input path.");
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+    return error("The input file could not be opened.");
+
+  // --scrub
+  const bool scrub = options.scrub;
+
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+      return error("Scrubbing is only supported for GC/Wii disc images.");
+
+    warning("The input file is not a GC/Wii disc image. Continuing anyway.");
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+      return error("Scrubbing a Datel disc is not supported.");
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+      return error("Unable to process disc image. Try again without --scrub.");
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    warning("Converting Wii disc images to GCZ without scrubbing may not offer space advantages "
+            "over ISO. Continuing anyway.");
+  }
+
+  if (volume && volume->IsNKit())
+    warning("Converting an NKit file, output will still be NKit! Continuing anyway.");
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(options.block_size.value(), volume->GetDataSize()))
+  {
+    warning("For GCZs to be compatible with Dolphin < 5.0-11893, the file size must be an integer "
+            "multiple of the block size and must not be an integer multiple of the block size "
+            "multiplied by 32. Continuing anyway.");
+  }
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  const auto start_time = std::chrono::steady_clock::now();
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                                   options.block_size.value(), NOOP_STATUS_CALLBACK,
+                                   &compressor_pool);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(
+        blob_reader.get(), input_file_path, output_file_path, format == DiscIO::BlobType::RVZ,
+        options.compression.value(), options.compression_level.value(),
+        options.block_size.value(), NOOP_STATUS_CALLBACK, &compressor_pool);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  if (!success)
+    return error("Conversion failed");
+
+  convert_result.seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  convert_result.input_size = blob_reader->GetDataSize();
+  convert_result.output_size = File::GetSize(output_file_path);
+  convert_result.success = true;
+  return convert_result;
+}
+
+static double ToMiB(u64 bytes)
+{
+  return bytes / (1024.0 * 1024.0);
+}
+
+static double GetMiBPerSecond(u64 bytes, double seconds)
+{
+  return seconds > 0 ? ToMiB(bytes) / seconds : 0;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -69,14 +257,16 @@ int ConvertCommand(const std::vector<std::string>& args)
 
   parser.add_option("-i", "--input")
       .type("string")
-      .action("store")
-      .help("Path to disc image FILE.")
+      .action("append")
+      .help("Path to disc image FILE, or to a directory containing disc images. Can be given "
+            "multiple times to convert several files in one batch.")
       .metavar("FILE");
 
   parser.add_option("-o", "--output")
       .type("string")
       .action("store")
-      .help("Path to the destination FILE.")
+      .help("Path to the destination FILE. When converting a batch, path to the directory that "
+            "the converted files are written to.")
       .metavar("FILE");
 
   parser.add_option("-f", "--format")
@@ -108,6 +298,25 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of files to convert at the same time. All of them share one set of "
+            "compression threads. [default: %default]")
+      .set_default(1);
+
+  parser.add_option("-t", "--threads")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of compression threads shared by all jobs. "
+            "Default is one per hardware thread.");
+
+  parser.add_option("-m", "--memory_limit")
+      .type("int")
+      .action("store")
+      .help("Optional. Approximate limit in MiB for data that is buffered for compression across "
+            "all jobs. Default is two blocks per compression thread.");
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -123,7 +332,34 @@ int ConvertCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
+  const std::list<std::string> input_list = options.all("input");
+
+  constexpr auto disc_image_extensions =
+      std::to_array<std::string_view>({".gcm", ".tgc", ".bin", ".iso", ".ciso", ".gcz", ".wbfs",
+                                       ".wia", ".rvz", ".nfs"});
+
+  bool batch = input_list.size() > 1;
+  std::vector<std::string> input_file_paths;
+  for (const std::string& input : input_list)
+  {
+    if (File::IsDirectory(input))
+    {
+      batch = true;
+      std::vector<std::string> found = Common::DoFileSearch(input, disc_image_extensions);
+      std::ranges::sort(found);
+      input_file_paths.insert(input_file_paths.end(), found.begin(), found.end());
+    }
+    else
+    {
+      input_file_paths.push_back(input);
+    }
+  }
+
+  if (input_file_paths.empty())
+  {
+    fmt::print(std::cerr, "Error: No disc images found in the input directory\n");
+    return EXIT_FAILURE;
+  }
 
   // --output
   if (!options.is_set("output"))
@@ -131,7 +367,9 @@ int ConvertCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No output set\n");
     return EXIT_FAILURE;
   }
-  const std::string& output_file_path = options["output"];
+  const std::string& output_path = options["output"];
+  if (!batch && File::IsDirectory(output_path))
+    batch = true;
 
   // --format
   const std::optional<DiscIO::BlobType> format_o = ParseFormatString(options["format"]);
@@ -142,75 +380,27 @@ int ConvertCommand(const std::vector<std::string>& args)
   }
   const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
-  {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
-    return EXIT_FAILURE;
-  }
+  ConvertOptions convert_options;
+  convert_options.format = format;
+  convert_options.label_output = batch;
 
   // --scrub
-  const bool scrub = static_cast<bool>(options.get("scrub"));
+  convert_options.scrub = static_cast<bool>(options.get("scrub"));
 
-  // Open the volume
-  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
-  {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
-
-  if (scrub && format == DiscIO::BlobType::RVZ)
+  if (convert_options.scrub && format == DiscIO::BlobType::RVZ)
   {
     fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
                           "advantages. Continuing anyway.\n");
   }
 
-  if (scrub && format == DiscIO::BlobType::PLAIN)
+  if (convert_options.scrub && format == DiscIO::BlobType::PLAIN)
   {
     fmt::print(std::cerr, "Warning: Scrubbing does not save space when converting to ISO unless "
                           "using external compression. Continuing anyway.\n");
   }
 
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
-
   // --block_size
-  std::optional<int> block_size_o;
+  std::optional<int>& block_size_o = convert_options.block_size;
   if (options.is_set("block_size"))
     block_size_o = static_cast<int>(options.get("block_size"));
 
@@ -235,22 +425,13 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
-  const std::optional<DiscIO::WIARVZCompressionType> compression_o =
-      ParseCompressionTypeString(options["compression"]);
+  std::optional<DiscIO::WIARVZCompressionType>& compression_o = convert_options.compression;
+  compression_o = ParseCompressionTypeString(options["compression"]);
 
-  std::optional<int> compression_level_o;
+  std::optional<int>& compression_level_o = convert_options.compression_level;
   if (options.is_set("compression_level"))
     compression_level_o = static_cast<int>(options.get("compression_level"));
 
@@ -294,58 +475,146 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
-
-  switch (format)
-  {
-  case DiscIO::BlobType::PLAIN:
+  // --jobs, --threads, --memory_limit
+  const int jobs = static_cast<int>(options.get("jobs"));
+  if (jobs < 1)
   {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
+    fmt::print(std::cerr, "Error: The number of jobs must be at least 1\n");
+    return EXIT_FAILURE;
   }
 
-  case DiscIO::BlobType::GCZ:
+  size_t thread_count = DiscIO::CompressorPool::GetDefaultThreadCount();
+  if (options.is_set("threads"))
   {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
+    const int threads = static_cast<int>(options.get("threads"));
+    if (threads < 1)
     {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
+      fmt::print(std::cerr, "Error: The number of threads must be at least 1\n");
+      return EXIT_FAILURE;
     }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
+    thread_count = threads;
   }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
+  // Every item in flight holds its uncompressed input as well as its compressed output. WIA and
+  // RVZ always work on whole Wii groups, even when the block size is smaller than that.
+  u64 item_size = block_size_o.value_or(0);
+  if (format == DiscIO::BlobType::WIA || format == DiscIO::BlobType::RVZ)
+    item_size = std::max(item_size, DiscIO::VolumeWii::GROUP_TOTAL_SIZE);
+  item_size = std::max<u64>(item_size * 2, 1);
+
+  size_t max_items_in_flight = thread_count * 2;
+  if (options.is_set("memory_limit"))
   {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
+    const int memory_limit = static_cast<int>(options.get("memory_limit"));
+    if (memory_limit < 1)
+    {
+      fmt::print(std::cerr, "Error: The memory limit must be at least 1 MiB\n");
+      return EXIT_FAILURE;
+    }
+
+    max_items_in_flight = u64(memory_limit) * 1024 * 1024 / item_size;
+    if (max_items_in_flight < thread_count)
+    {
+      fmt::print(std::cerr, "Warning: The memory limit is too low to keep all compression threads "
+                            "busy. Continuing anyway.\n");
+    }
   }
 
-  default:
+  // Work out where each file goes
+  std::vector<std::string> output_file_paths;
+  if (!batch)
   {
-    ASSERT(false);
-    break;
+    output_file_paths.push_back(output_path);
   }
+  else
+  {
+    if (!File::IsDirectory(output_path) && !File::CreateFullPath(output_path + '/'))
+    {
+      fmt::print(std::cerr, "Error: The output directory could not be created\n");
+      return EXIT_FAILURE;
+    }
+
+    std::set<std::string> used_output_file_paths;
+    for (const std::string& input_file_path : input_file_paths)
+    {
+      std::string name;
+      SplitPath(WithUnifiedPathSeparators(input_file_path), nullptr, &name, nullptr);
+      std::string output_file_path =
+          fmt::format("{}/{}{}", output_path, name, GetFormatExtension(format));
+
+      if (!used_output_file_paths.insert(output_file_path).second)
+      {
+        fmt::print(std::cerr, "Error: More than one input would be written to {}\n",
+                   output_file_path);
+        return EXIT_FAILURE;
+      }
+
+      output_file_paths.push_back(std::move(output_file_path));
+    }
   }
 
-  if (!success)
+  DiscIO::CompressorPool compressor_pool(thread_count, max_items_in_flight);
+
+  // Results are printed in the order the files were given, as soon as they are available.
+  std::vector<std::optional<ConvertResult>> results(input_file_paths.size());
+  std::mutex results_mutex;
+  size_t next_result_to_print = 0;
+  size_t succeeded_count = 0;
+  u64 total_input_size = 0;
+  u64 total_output_size = 0;
+
+  const auto start_time = std::chrono::steady_clock::now();
+
+  std::atomic<size_t> next_file = 0;
+  const auto run_jobs = [&] {
+    for (size_t i = next_file++; i < input_file_paths.size(); i = next_file++)
+    {
+      ConvertResult result =
+          ConvertFile(input_file_paths[i], output_file_paths[i], convert_options, compressor_pool);
+
+      std::lock_guard lk(results_mutex);
+      results[i] = std::move(result);
+      for (; next_result_to_print < results.size() && results[next_result_to_print];
+           ++next_result_to_print)
+      {
+        const ConvertResult& printed_result = *results[next_result_to_print];
+        fmt::print(std::cerr, "{}", printed_result.messages);
+        if (!printed_result.success)
+          continue;
+
+        ++succeeded_count;
+        total_input_size += printed_result.input_size;
+        total_output_size += printed_result.output_size;
+
+        if (batch)
+        {
+          fmt::print(std::cout, "{}: {:.1f} MiB -> {:.1f} MiB in {:.1f} s ({:.1f} MiB/s)\n",
+                     input_file_paths[next_result_to_print], ToMiB(printed_result.input_size),
+                     ToMiB(printed_result.output_size), printed_result.seconds,
+                     GetMiBPerSecond(printed_result.input_size, printed_result.seconds));
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> job_threads;
+  const size_t job_thread_count = std::min<size_t>(jobs, input_file_paths.size()) - 1;
+  for (size_t i = 0; i < job_thread_count; ++i)
+    job_threads.emplace_back(run_jobs);
+  run_jobs();
+  for (std::thread& thread : job_threads)
+    thread.join();
+
+  if (batch)
   {
-    fmt::print(std::cerr, "Error: Conversion failed\n");
-    return EXIT_FAILURE;
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    fmt::print(std::cout,
+               "Converted {} of {} files: {:.1f} MiB -> {:.1f} MiB in {:.1f} s ({:.1f} MiB/s)\n",
+               succeeded_count, input_file_paths.size(), ToMiB(total_input_size),
+               ToMiB(total_output_size), seconds, GetMiBPerSecond(total_input_size, seconds));
   }
 
-  return EXIT_SUCCESS;
+  return succeeded_count == input_file_paths.size() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 }  // namespace DolphinTool
@@ -3,13 +3,21 @@
 
 #include "DolphinTool/VerifyCommand.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
 #include <fmt/ostream.h>
 
+#include "Common/ThreadPool.h"
 #include "Core/AchievementManager.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/VolumeVerifier.h"
@@ -28,48 +36,144 @@ static std::string HashToHexString(const std::vector<u8>& hash)
   return ss.str();
 }
 
-static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
+static std::string FormatFullReport(const DiscIO::VolumeVerifier::Result& result)
 {
+  std::string report;
+  auto out = std::back_inserter(report);
+
   if (!result.hashes.crc32.empty())
-    fmt::print(std::cout, "CRC32: {}\n", HashToHexString(result.hashes.crc32));
+    fmt::format_to(out, "CRC32: {}\n", HashToHexString(result.hashes.crc32));
   else
-    fmt::print(std::cout, "CRC32 not computed\n");
+    fmt::format_to(out, "CRC32 not computed\n");
 
   if (!result.hashes.md5.empty())
-    fmt::print(std::cout, "MD5: {}\n", HashToHexString(result.hashes.md5));
+    fmt::format_to(out, "MD5: {}\n", HashToHexString(result.hashes.md5));
   else
-    fmt::print(std::cout, "MD5 not computed\n");
+    fmt::format_to(out, "MD5 not computed\n");
 
   if (!result.hashes.sha1.empty())
-    fmt::print(std::cout, "SHA1: {}\n", HashToHexString(result.hashes.sha1));
+    fmt::format_to(out, "SHA1: {}\n", HashToHexString(result.hashes.sha1));
   else
-    fmt::print(std::cout, "SHA1 not computed\n");
+    fmt::format_to(out, "SHA1 not computed\n");
 
-  fmt::print(std::cout, "Problems Found: {}\n", result.problems.empty() ? "No" : "Yes");
+  fmt::format_to(out, "Problems Found: {}\n", result.problems.empty() ? "No" : "Yes");
 
   for (const auto& problem : result.problems)
   {
-    fmt::print(std::cout, "\nSeverity: ");
+    fmt::format_to(out, "\nSeverity: ");
     switch (problem.severity)
     {
     case DiscIO::VolumeVerifier::Severity::Low:
-      fmt::print(std::cout, "Low");
+      fmt::format_to(out, "Low");
       break;
     case DiscIO::VolumeVerifier::Severity::Medium:
-      fmt::print(std::cout, "Medium");
+      fmt::format_to(out, "Medium");
       break;
     case DiscIO::VolumeVerifier::Severity::High:
-      fmt::print(std::cout, "High");
+      fmt::format_to(out, "High");
       break;
     case DiscIO::VolumeVerifier::Severity::None:
-      fmt::print(std::cout, "None");
+      fmt::format_to(out, "None");
       break;
     default:
       ASSERT(false);
       break;
     }
-    fmt::print(std::cout, "\nSummary: {}\n\n", problem.text);
+    fmt::format_to(out, "\nSummary: {}\n\n", problem.text);
+  }
+
+  return report;
+}
+
+namespace
+{
+struct VerifyOptions
+{
+  DiscIO::Hashes<bool> hashes_to_calculate{};
+  bool algorithm_is_set = false;
+  bool rc_hash_calculate = false;
+  // Whether each report is labeled with the path of the file it belongs to
+  bool label_output = false;
+};
+
+struct VerifyResult
+{
+  bool success = false;
+  std::string output;
+  std::string error;
+};
+}  // namespace
+
+static VerifyResult VerifyFile(const std::string& input_file_path, const VerifyOptions& options,
+                               Common::ThreadPool& thread_pool)
+{
+  VerifyResult verify_result;
+  const std::string error_prefix =
+      options.label_output ? fmt::format("Error: {}: ", input_file_path) : "Error: ";
+
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(input_file_path);
+  if (!volume)
+  {
+    verify_result.error = error_prefix + "Unable to open input file\n";
+    return verify_result;
+  }
+
+  // Verify the volume
+  DiscIO::VolumeVerifier verifier(*volume, false, options.hashes_to_calculate, &thread_pool);
+  verifier.Start();
+  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+  {
+    verifier.Process();
+  }
+  verifier.Finish();
+  const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
+
+  std::string rc_hash_result = "0";
+#ifdef USE_RETRO_ACHIEVEMENTS
+  // Calculate rcheevos hash
+  if (options.rc_hash_calculate)
+  {
+    // CalculateHash goes through the AchievementManager singleton and rcheevos' global file reader
+    // callbacks, so only one file can be hashed at a time.
+    static std::mutex rc_hash_mutex;
+    std::lock_guard lk(rc_hash_mutex);
+    rc_hash_result = AchievementManager::CalculateHash(input_file_path);
+  }
+#endif
+
+  // Format the report
+  if (!options.algorithm_is_set)
+  {
+    if (options.label_output)
+      verify_result.output = fmt::format("File: {}\n", input_file_path);
+    verify_result.output += FormatFullReport(result);
+  }
+  else
+  {
+    std::string hash;
+    if (options.hashes_to_calculate.crc32 && !result.hashes.crc32.empty())
+      hash = HashToHexString(result.hashes.crc32);
+    else if (options.hashes_to_calculate.md5 && !result.hashes.md5.empty())
+      hash = HashToHexString(result.hashes.md5);
+    else if (options.hashes_to_calculate.sha1 && !result.hashes.sha1.empty())
+      hash = HashToHexString(result.hashes.sha1);
+    else if (options.rc_hash_calculate)
+      hash = rc_hash_result;
+    else
+    {
+      verify_result.error = error_prefix + "No hash computed\n";
+      return verify_result;
+    }
+
+    if (options.label_output)
+      verify_result.output = fmt::format("{}  {}\n", hash, input_file_path);
+    else
+      verify_result.output = fmt::format("{}\n", hash);
   }
+
+  verify_result.success = true;
+  return verify_result;
 }
 
 int VerifyCommand(const std::vector<std::string>& args)
@@ -87,8 +191,8 @@ int VerifyCommand(const std::vector<std::string>& args)
 
   parser.add_option("-i", "--input")
       .type("string")
-      .action("store")
-      .help("Path to input file.")
+      .action("append")
+      .help("Path to input file. Can be given multiple times to verify several files.")
       .metavar("FILE");
 
   parser.add_option("-a", "--algorithm")
@@ -98,6 +202,13 @@ int VerifyCommand(const std::vector<std::string>& args)
             "[%choices]")
       .choices({"crc32", "md5", "sha1", "rchash"});
 
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of files to verify at the same time. All of them share one set of "
+            "hashing threads. [default: %default]")
+      .set_default(1);
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -111,88 +222,85 @@ int VerifyCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
+  const std::list<std::string> input_list = options.all("input");
+  const std::vector<std::string> input_file_paths(input_list.begin(), input_list.end());
 
-  bool rc_hash_calculate = false;
-  std::string rc_hash_result = "0";
+  const int jobs = static_cast<int>(options.get("jobs"));
+  if (jobs < 1)
+  {
+    fmt::print(std::cerr, "Error: The number of jobs must be at least 1\n");
+    return EXIT_FAILURE;
+  }
 
-  DiscIO::Hashes<bool> hashes_to_calculate{};
-  const bool algorithm_is_set = options.is_set("algorithm");
-  if (!algorithm_is_set)
+  VerifyOptions verify_options;
+  verify_options.label_output = input_file_paths.size() > 1;
+
+  verify_options.algorithm_is_set = options.is_set("algorithm");
+  if (!verify_options.algorithm_is_set)
   {
-    hashes_to_calculate = DiscIO::VolumeVerifier::GetDefaultHashesToCalculate();
+    verify_options.hashes_to_calculate = DiscIO::VolumeVerifier::GetDefaultHashesToCalculate();
   }
   else
   {
     const std::string& algorithm = options["algorithm"];
     if (algorithm == "crc32")
-      hashes_to_calculate.crc32 = true;
+      verify_options.hashes_to_calculate.crc32 = true;
     else if (algorithm == "md5")
-      hashes_to_calculate.md5 = true;
+      verify_options.hashes_to_calculate.md5 = true;
     else if (algorithm == "sha1")
-      hashes_to_calculate.sha1 = true;
+      verify_options.hashes_to_calculate.sha1 = true;
 #ifdef USE_RETRO_ACHIEVEMENTS
     else if (algorithm == "rchash")
-      rc_hash_calculate = true;
+      verify_options.rc_hash_calculate = true;
 #endif
   }
 
+  const DiscIO::Hashes<bool>& hashes_to_calculate = verify_options.hashes_to_calculate;
   if (!hashes_to_calculate.crc32 && !hashes_to_calculate.md5 && !hashes_to_calculate.sha1 &&
-      !rc_hash_calculate)
+      !verify_options.rc_hash_calculate)
   {
     // optparse should protect from this
     fmt::print(std::cerr, "Error: No algorithms selected for the operation\n");
     return EXIT_FAILURE;
   }
 
-  // Open the volume
-  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(input_file_path);
-  if (!volume)
-  {
-    fmt::print(std::cerr, "Error: Unable to open input file\n");
-    return EXIT_FAILURE;
-  }
+  // Reading happens on the job threads, and everything else on this shared pool.
+  Common::ThreadPool thread_pool("Verify",
+                                 std::max<size_t>(Common::ThreadPool::GetDefaultThreadCount(), 1));
 
-  // Verify the volume
-  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
-  verifier.Start();
-  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
-  {
-    verifier.Process();
-  }
-  verifier.Finish();
-  const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
+  // Reports are printed in the order the files were given, as soon as they are available.
+  std::vector<std::optional<VerifyResult>> results(input_file_paths.size());
+  std::mutex results_mutex;
+  size_t next_result_to_print = 0;
+  bool all_succeeded = true;
 
-#ifdef USE_RETRO_ACHIEVEMENTS
-  // Calculate rcheevos hash
-  if (rc_hash_calculate)
-  {
-    rc_hash_result = AchievementManager::CalculateHash(input_file_path);
-  }
-#endif
-
-  // Print the report
-  if (!algorithm_is_set)
-  {
-    PrintFullReport(result);
-  }
-  else
-  {
-    if (hashes_to_calculate.crc32 && !result.hashes.crc32.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.crc32));
-    else if (hashes_to_calculate.md5 && !result.hashes.md5.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.md5));
-    else if (hashes_to_calculate.sha1 && !result.hashes.sha1.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.sha1));
-    else if (rc_hash_calculate)
-      fmt::print(std::cout, "{}\n", rc_hash_result);
-    else
+  std::atomic<size_t> next_file = 0;
+  const auto run_jobs = [&] {
+    for (size_t i = next_file++; i < input_file_paths.size(); i = next_file++)
     {
-      fmt::print(std::cerr, "Error: No hash computed\n");
-      return EXIT_FAILURE;
+      VerifyResult result = VerifyFile(input_file_paths[i], verify_options, thread_pool);
+
+      std::lock_guard lk(results_mutex);
+      results[i] = std::move(result);
+      for (; next_result_to_print < results.size() && results[next_result_to_print];
+           ++next_result_to_print)
+      {
+        const VerifyResult& printed_result = *results[next_result_to_print];
+        fmt::print(std::cerr, "{}", printed_result.error);
+        fmt::print(std::cout, "{}", printed_result.output);
+        all_succeeded &= printed_result.success;
+      }
     }
-  }
+  };
+
+  std::vector<std::thread> job_threads;
+  const size_t job_thread_count = std::min<size_t>(jobs, input_file_paths.size()) - 1;
+  for (size_t i = 0; i < job_thread_count; ++i)
+    job_threads.emplace_back(run_jobs);
+  run_jobs();
+  for (std::thread& thread : job_threads)
+    thread.join();
 
-  return EXIT_SUCCESS;
+  return all_succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 }  // namespace DolphinTool
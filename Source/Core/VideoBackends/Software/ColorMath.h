@@ -0,0 +1,164 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
+
+// Arithmetic that the software renderer does on every channel of a color, for every TEV stage,
+// blend and filtered texture fetch of every pixel. On x86-64 all four channels are processed at
+// once with SSE2, which every x86-64 CPU supports, so there is nothing to check at runtime.
+namespace ColorMath
+{
+using Channels = std::array<s16, 4>;
+
+struct CombinerParams
+{
+  s32 bias;
+  u32 left_shift;
+  u32 right_shift;
+  // Added before dividing the lerp by 256
+  s32 rounding;
+  bool subtract;
+  s16 min;
+  s16 max;
+};
+
+// Evaluates the regular TEV color combiner for all channels, as in
+// clamp((((d + bias) << left_shift) +- ((lerp(a, b, c) << left_shift + rounding) >> 8)) >>
+// right_shift). a, b and c must be within [0, 255] and d within [-1024, 1023].
+inline Channels CombineRegular(const Channels& a, const Channels& b, const Channels& c,
+                               const Channels& d, const CombinerParams& params)
+{
+  Channels result;
+#ifdef _M_X86_64
+  const __m128i va = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(a.data()));
+  const __m128i vb = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(b.data()));
+  __m128i vc = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(c.data()));
+  const __m128i vd = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(d.data()));
+
+  // a * (256 - c) + b * c for each channel, with c extended to [0, 256]
+  vc = _mm_add_epi16(vc, _mm_srli_epi16(vc, 7));
+  const __m128i inverse_c = _mm_sub_epi16(_mm_set1_epi16(256), vc);
+  __m128i lerp = _mm_madd_epi16(_mm_unpacklo_epi16(va, vb), _mm_unpacklo_epi16(inverse_c, vc));
+
+  const __m128i left_shift = _mm_cvtsi32_si128(params.left_shift);
+  lerp = _mm_sll_epi32(lerp, left_shift);
+  lerp = _mm_add_epi32(lerp, _mm_set1_epi32(params.rounding));
+  lerp = _mm_srai_epi32(lerp, 8);
+  if (params.subtract)
+    lerp = _mm_sub_epi32(_mm_setzero_si128(), lerp);
+
+  __m128i sum = _mm_srai_epi32(_mm_unpacklo_epi16(vd, vd), 16);
+  sum = _mm_add_epi32(sum, _mm_set1_epi32(params.bias));
+  sum = _mm_add_epi32(_mm_sll_epi32(sum, left_shift), lerp);
+  sum = _mm_sra_epi32(sum, _mm_cvtsi32_si128(params.right_shift));
+
+  // The sum always fits in 16 bits, so the saturation in the pack never kicks in.
+  __m128i packed = _mm_packs_epi32(sum, sum);
+  packed = _mm_max_epi16(packed, _mm_set1_epi16(params.min));
+  packed = _mm_min_epi16(packed, _mm_set1_epi16(params.max));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(result.data()), packed);
+#else
+  for (size_t i = 0; i < result.size(); i++)
+  {
+    const s32 extended_c = c[i] + (c[i] >> 7);
+
+    s32 lerp = a[i] * (256 - extended_c) + b[i] * extended_c;
+    lerp <<= params.left_shift;
+    lerp += params.rounding;
+    lerp >>= 8;
+    lerp = params.subtract ? -lerp : lerp;
+
+    s32 sum = ((d[i] + params.bias) << params.left_shift) + lerp;
+    sum >>= params.right_shift;
+
+    result[i] = std::clamp<s32>(sum, params.min, params.max);
+  }
+#endif
+  return result;
+}
+
+// Blends two colors as (src * src_factor + dst * dst_factor) >> 8, saturated to 255. Each byte of
+// a factor is the factor for the corresponding channel, with 255 standing for 1.
+inline void Blend(const u8* src, const u8* dst, u32 src_factor, u32 dst_factor, u8* out)
+{
+#ifdef _M_X86_64
+  u32 src_bits, dst_bits;
+  std::memcpy(&src_bits, src, sizeof(u32));
+  std::memcpy(&dst_bits, dst, sizeof(u32));
+
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i colors = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(src_bits), zero),
+                                            _mm_unpacklo_epi8(_mm_cvtsi32_si128(dst_bits), zero));
+  __m128i factors = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(src_factor), zero),
+                                       _mm_unpacklo_epi8(_mm_cvtsi32_si128(dst_factor), zero));
+
+  // Add the MSB of the factors to make their range 0 -> 256
+  factors = _mm_add_epi16(factors, _mm_srli_epi16(factors, 7));
+
+  __m128i blended = _mm_srli_epi32(_mm_madd_epi16(colors, factors), 8);
+  blended = _mm_packs_epi32(blended, blended);
+  blended = _mm_packus_epi16(blended, blended);
+
+  const u32 out_bits = static_cast<u32>(_mm_cvtsi128_si32(blended));
+  std::memcpy(out, &out_bits, sizeof(u32));
+#else
+  for (int i = 0; i < 4; i++)
+  {
+    // add MSB of factors to make their range 0 -> 256
+    u32 sf = (src_factor & 0xff);
+    sf += sf >> 7;
+
+    u32 df = (dst_factor & 0xff);
+    df += df >> 7;
+
+    const u32 color = (src[i] * sf + dst[i] * df) >> 8;
+    out[i] = (color > 255) ? 255 : color;
+
+    dst_factor >>= 8;
+    src_factor >>= 8;
+  }
+#endif
+}
+
+// Computes (t0 * w0 + t1 * w1 + t2 * w2 + t3 * w3) >> shift for every channel of four texels,
+// which is how texture samples are filtered. Each weight must be at most 0x4000, and the result
+// must fit in 8 bits.
+inline void Filter(const u8* t0, const u8* t1, const u8* t2, const u8* t3, s16 w0, s16 w1, s16 w2,
+                   s16 w3, u32 shift, u8* out)
+{
+#ifdef _M_X86_64
+  u32 bits[4];
+  std::memcpy(&bits[0], t0, sizeof(u32));
+  std::memcpy(&bits[1], t1, sizeof(u32));
+  std::memcpy(&bits[2], t2, sizeof(u32));
+  std::memcpy(&bits[3], t3, sizeof(u32));
+
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i texels01 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bits[0]), zero),
+                                              _mm_unpacklo_epi8(_mm_cvtsi32_si128(bits[1]), zero));
+  const __m128i texels23 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bits[2]), zero),
+                                              _mm_unpacklo_epi8(_mm_cvtsi32_si128(bits[3]), zero));
+  const __m128i weights01 = _mm_unpacklo_epi16(_mm_set1_epi16(w0), _mm_set1_epi16(w1));
+  const __m128i weights23 = _mm_unpacklo_epi16(_mm_set1_epi16(w2), _mm_set1_epi16(w3));
+
+  __m128i sum =
+      _mm_add_epi32(_mm_madd_epi16(texels01, weights01), _mm_madd_epi16(texels23, weights23));
+  sum = _mm_srl_epi32(sum, _mm_cvtsi32_si128(shift));
+  sum = _mm_packs_epi32(sum, sum);
+  sum = _mm_packus_epi16(sum, sum);
+
+  const u32 out_bits = static_cast<u32>(_mm_cvtsi128_si32(sum));
+  std::memcpy(out, &out_bits, sizeof(u32));
+#else
+  for (int i = 0; i < 4; i++)
+    out[i] = static_cast<u8>((t0[i] * w0 + t1[i] * w1 + t2[i] * w2 + t3[i] * w3) >> shift);
+#endif
+}
+}  // namespace ColorMath
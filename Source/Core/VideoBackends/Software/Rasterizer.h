@@ -10,6 +10,7 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+void Shutdown();
 void ScissorChanged();
 
 void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
@@ -17,6 +18,12 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
 
+// Finishes drawing all triangles passed to DrawTriangleFrontFace, and applies what they did to
+// statistics, performance counters and the bounding box. Triangles may be drawn on other threads
+// until this is called, so it must be called before anything else accesses the EFB or changes
+// the state they are drawn with.
+void Flush();
+
 void SetTevKonstColors();
 
 struct RasterBlockPixel
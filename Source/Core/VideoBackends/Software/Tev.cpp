@@ -12,11 +12,13 @@
 
 #include "Core/System.h"
 
+#include "VideoBackends/Software/ColorMath.h"
 #include "VideoBackends/Software/SWBoundingBox.h"
 #include "VideoBackends/Software/SWEfbInterface.h"
 #include "VideoBackends/Software/TextureSampler.h"
 
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/StageProfiler.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/XFMemory.h"
@@ -79,23 +81,29 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
 
 void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
 {
-  for (int i = BLU_C; i <= RED_C; i++)
+  ColorMath::Channels a, b, c, d;
+  for (int i = 0; i < 4; i++)
   {
-    const InputRegType& InputReg = inputs[i];
-
-    const u16 c = InputReg.c + (InputReg.c >> 7);
-
-    s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-    temp <<= s_ScaleLShiftLUT[cc.scale];
-    temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
-    temp >>= 8;
-    temp = cc.op == TevOp::Sub ? -temp : temp;
-
-    s32 result = ((InputReg.d + s_BiasLUT[cc.bias]) << s_ScaleLShiftLUT[cc.scale]) + temp;
-    result = result >> s_ScaleRShiftLUT[cc.scale];
-
-    Reg[cc.dest][i] = result;
+    a[i] = inputs[i].a;
+    b[i] = inputs[i].b;
+    c[i] = inputs[i].c;
+    d[i] = inputs[i].d;
   }
+
+  const ColorMath::CombinerParams params{
+      .bias = s_BiasLUT[cc.bias],
+      .left_shift = s_ScaleLShiftLUT[cc.scale],
+      .right_shift = s_ScaleRShiftLUT[cc.scale],
+      .rounding = (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128,
+      .subtract = cc.op == TevOp::Sub,
+      .min = cc.clamp ? s16(0) : s16(-1024),
+      .max = cc.clamp ? s16(255) : s16(1023),
+  };
+
+  // The alpha channel is combined by the alpha combiner, which rounds differently.
+  const ColorMath::Channels result = ColorMath::CombineRegular(a, b, c, d, params);
+  for (int i = BLU_C; i <= RED_C; i++)
+    Reg[cc.dest][i] = result[i];
 }
 
 void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
@@ -389,7 +397,7 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  ++Counters.tev_pixels_in;
 
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
@@ -507,22 +515,27 @@ void Tev::Draw()
     inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
     inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
 
+    // DrawColorRegular clamps the result itself.
     if (cc.bias != TevBias::Compare)
-      DrawColorRegular(cc, inputs);
-    else
-      DrawColorCompare(cc, inputs);
-
-    if (cc.clamp)
     {
-      Reg[cc.dest].r = Clamp255(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp255(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp255(Reg[cc.dest].b);
+      DrawColorRegular(cc, inputs);
     }
     else
     {
-      Reg[cc.dest].r = Clamp1024(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp1024(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
+      DrawColorCompare(cc, inputs);
+
+      if (cc.clamp)
+      {
+        Reg[cc.dest].r = Clamp255(Reg[cc.dest].r);
+        Reg[cc.dest].g = Clamp255(Reg[cc.dest].g);
+        Reg[cc.dest].b = Clamp255(Reg[cc.dest].b);
+      }
+      else
+      {
+        Reg[cc.dest].r = Clamp1024(Reg[cc.dest].r);
+        Reg[cc.dest].g = Clamp1024(Reg[cc.dest].g);
+        Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
+      }
     }
 
     if (ac.bias != TevBias::Compare)
@@ -663,21 +676,23 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    ++Counters.perf_pixels[PQ_ZCOMP_INPUT];
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    ++Counters.perf_pixels[PQ_ZCOMP_OUTPUT];
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  Counters.bbox_left = std::min(Counters.bbox_left, static_cast<u16>(Position[0] & ~1));
+  Counters.bbox_right = std::max(Counters.bbox_right, static_cast<u16>(Position[0] | 1));
+  Counters.bbox_top = std::min(Counters.bbox_top, static_cast<u16>(Position[1] & ~1));
+  Counters.bbox_bottom = std::max(Counters.bbox_bottom, static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  ++Counters.tev_pixels_out;
+  ++Counters.perf_pixels[PQ_BLEND_INPUT];
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
@@ -695,3 +710,23 @@ void Tev::SetKonstColors()
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
   }
 }
+
+void Tev::ApplyCounters()
+{
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, Counters.rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, Counters.tev_pixels_in);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, Counters.tev_pixels_out);
+  StageProfiler::AddRasterizedPixels(Counters.rasterized_pixels);
+
+  for (size_t i = 0; i < Counters.perf_pixels.size(); i++)
+  {
+    if (Counters.perf_pixels[i] != 0)
+      EfbInterface::AddPerfCounterPixels(static_cast<PerfQueryType>(i), Counters.perf_pixels[i]);
+  }
+
+  // The initial values leave the bounding box alone if nothing was drawn.
+  BBoxManager::Update(Counters.bbox_left, Counters.bbox_right, Counters.bbox_top,
+                      Counters.bbox_bottom);
+
+  Counters = {};
+}
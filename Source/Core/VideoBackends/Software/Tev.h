@@ -7,6 +7,7 @@
 
 #include "Common/EnumMap.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -214,6 +215,20 @@ class Tev
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
 public:
+  // What drawing pixels has affected besides the EFB. This is collected per Tev so that several
+  // of them can draw at once, and applied to the global state by ApplyCounters.
+  struct PixelCounters
+  {
+    u32 rasterized_pixels = 0;
+    u32 tev_pixels_in = 0;
+    u32 tev_pixels_out = 0;
+    std::array<u32, PQ_NUM_MEMBERS> perf_pixels{};
+    u16 bbox_left = 0xFFFF;
+    u16 bbox_right = 0;
+    u16 bbox_top = 0xFFFF;
+    u16 bbox_bottom = 0;
+  };
+
   s32 Position[3]{};
   u8 Color[2][4]{};  // must be RGBA for correct swap table ordering
   TextureCoordinateType Uv[8]{};
@@ -221,6 +236,7 @@ public:
   bool IndirectLinear[4]{};
   s32 TextureLod[16]{};
   bool TextureLinear[16]{};
+  PixelCounters Counters;
 
   enum
   {
@@ -232,4 +248,5 @@ public:
 
   void SetKonstColors();
   void Draw();
+  void ApplyCounters();
 };
@@ -0,0 +1,242 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/DecodedTextureCache.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Random.h"
+#include "Common/StringUtil.h"
+#include "Common/VariantUtil.h"
+#include "Common/Version.h"
+
+namespace VideoCommon
+{
+namespace
+{
+constexpr std::string_view ENTRY_EXTENSION = ".rgba";
+constexpr u32 ENTRY_VERSION = 1;
+// After the cache is opened, the entries that were used the longest time ago are deleted until the
+// cache fits in this size.
+constexpr u64 MAX_CACHE_SIZE = u64(1) << 30;
+
+struct EntryHeader
+{
+  static EntryHeader Create(u64 data_size)
+  {
+    EntryHeader header{};
+    std::memcpy(&header.id, "DTEX", sizeof(u32));
+    header.version = ENTRY_VERSION;
+    // Decoders change between builds, so entries written by other builds aren't used.
+    const std::string& revision = Common::GetScmRevGitStr();
+    std::memcpy(header.revision, revision.data(),
+                std::min(revision.size(), sizeof(header.revision)));
+    header.data_size = data_size;
+    return header;
+  }
+
+  u32 id;
+  u32 version;
+  char revision[40];
+  u64 data_size;
+};
+
+// Returns whether the file is an intact entry written by this build.
+bool IsUsableEntry(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  EntryHeader header;
+  if (!file.ReadArray(&header, 1))
+    return false;
+
+  const EntryHeader expected_header = EntryHeader::Create(header.data_size);
+  return std::memcmp(&header, &expected_header, sizeof(header)) == 0 &&
+         file.GetSize() == sizeof(header) + header.data_size;
+}
+}  // namespace
+
+DecodedTextureCache::DecodedTextureCache() = default;
+
+DecodedTextureCache::~DecodedTextureCache()
+{
+  Close();
+}
+
+void DecodedTextureCache::Open()
+{
+  if (m_open)
+    return;
+
+  m_directory = File::GetUserPath(D_CACHE_IDX) + "DecodedTextures" DIR_SEP;
+  if (!File::IsDirectory(m_directory) && !File::CreateFullPath(m_directory))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to create decoded texture cache directory {}", m_directory);
+    return;
+  }
+
+  // Only list the entries here, since the cache can hold many of them. They're checked when read.
+  for (const std::string& path : Common::DoFileSearch(m_directory, ENTRY_EXTENSION))
+  {
+    std::string filename;
+    std::string extension;
+    SplitPath(path, nullptr, &filename, &extension);
+    m_entries.insert(filename + extension);
+  }
+  INFO_LOG_FMT(VIDEO, "Found {} decoded textures in {}", m_entries.size(), m_directory);
+
+  m_write_thread.Reset("Decoded Texture Cache Writer", [this](Job job) { RunJob(job); });
+  m_write_thread.Push(Prune{});
+  m_open = true;
+}
+
+void DecodedTextureCache::Close()
+{
+  if (!m_open)
+    return;
+
+  m_write_thread.Shutdown();
+  m_entries.clear();
+  m_used_entries.clear();
+  m_open = false;
+}
+
+std::string DecodedTextureCache::GetFileName(const Key& key)
+{
+  return fmt::format("{:016x}_{:016x}_{}_{}_{}x{}_{}{}", key.data_hash, key.tlut_hash,
+                     static_cast<int>(key.format), static_cast<int>(key.tlut_format),
+                     key.expanded_width, key.expanded_height, key.levels, ENTRY_EXTENSION);
+}
+
+bool DecodedTextureCache::Read(const Key& key, u8* dst, size_t size)
+{
+  const std::string filename = GetFileName(key);
+  const auto it = m_entries.find(filename);
+  if (it == m_entries.end())
+    return false;
+
+  const std::string path = m_directory + filename;
+  File::IOFile file(path, "rb");
+  EntryHeader header;
+  const EntryHeader expected_header = EntryHeader::Create(size);
+  if (!file.ReadArray(&header, 1) || std::memcmp(&header, &expected_header, sizeof(header)) != 0 ||
+      !file.ReadBytes(dst, size))
+  {
+    // Written by another build, damaged or pruned. Decode the texture and replace the entry.
+    m_entries.erase(it);
+    return false;
+  }
+
+  if (m_used_entries.insert(filename).second)
+    m_write_thread.Push(MarkEntryUsed{filename});
+  return true;
+}
+
+void DecodedTextureCache::Write(const Key& key, const u8* data, size_t size)
+{
+  std::string filename = GetFileName(key);
+  if (!m_entries.insert(filename).second)
+    return;
+
+  m_write_thread.Push(WriteEntry{std::move(filename), std::vector<u8>(data, data + size)});
+}
+
+void DecodedTextureCache::RunJob(const Job& job) const
+{
+  std::visit(overloaded{
+                 [this](const WriteEntry& write) { WriteFile(write); },
+                 [this](const MarkEntryUsed& mark) {
+                   // The modification time of an entry is the time it was last used.
+                   const auto now = std::filesystem::file_time_type::clock::now();
+                   std::error_code error;
+                   std::filesystem::last_write_time(StringToPath(m_directory + mark.filename), now,
+                                                    error);
+                 },
+                 [this](const Prune&) { PruneEntries(); },
+             },
+             job);
+}
+
+void DecodedTextureCache::WriteFile(const WriteEntry& write) const
+{
+  const std::string path = m_directory + write.filename;
+  // Other instances may be writing the same entry at the same time.
+  const std::string temp_path =
+      fmt::format("{}.{:016x}.tmp", path, Common::Random::GenerateValue<u64>());
+
+  {
+    File::IOFile file(temp_path, "wb");
+    const EntryHeader header = EntryHeader::Create(write.data.size());
+    if (!file.WriteArray(&header, 1) || !file.WriteBytes(write.data.data(), write.data.size()))
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to write decoded texture {}", temp_path);
+      file.Close();
+      File::Delete(temp_path);
+      return;
+    }
+  }
+
+  if (!File::Rename(temp_path, path))
+    File::Delete(temp_path);
+}
+
+void DecodedTextureCache::PruneEntries() const
+{
+  struct DiskEntry
+  {
+    std::filesystem::file_time_type last_used;
+    u64 size;
+    std::string path;
+  };
+  std::vector<DiskEntry> disk_entries;
+  u64 total_size = 0;
+  size_t deleted = 0;
+
+  // Entries that have been deleted here stay in m_entries, and reading them simply fails.
+  for (std::string& path : Common::DoFileSearch(m_directory, ENTRY_EXTENSION))
+  {
+    // Entries written by other builds would never be used again.
+    if (!IsUsableEntry(path))
+    {
+      File::Delete(path);
+      ++deleted;
+      continue;
+    }
+
+    std::error_code error;
+    const auto last_used = std::filesystem::last_write_time(StringToPath(path), error);
+    const u64 size = File::GetSize(path);
+    total_size += size;
+    disk_entries.push_back(DiskEntry{last_used, size, std::move(path)});
+  }
+
+  if (total_size > MAX_CACHE_SIZE)
+  {
+    std::ranges::sort(disk_entries, {}, &DiskEntry::last_used);
+    for (auto it = disk_entries.begin(); it != disk_entries.end() && total_size > MAX_CACHE_SIZE;
+         ++it)
+    {
+      File::Delete(it->path);
+      total_size -= it->size;
+      ++deleted;
+    }
+  }
+
+  INFO_LOG_FMT(VIDEO, "Decoded texture cache holds {} MiB after deleting {} textures",
+               total_size >> 20, deleted);
+}
+}  // namespace VideoCommon
@@ -0,0 +1,86 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+
+enum class TextureFormat;
+enum class TLUTFormat;
+
+namespace VideoCommon
+{
+// Keeps textures decoded to RGBA8 on disk, so that they don't have to be decoded again in later
+// sessions. Entries are addressed by the contents of the texture, so they are shared by every game
+// and every instance of Dolphin on the same host. Each entry is a file of its own, which is written
+// under a temporary name and renamed into place, so instances never see each other's partial files.
+// After the cache is opened, the background thread deletes entries written by other builds, and the
+// least recently used entries if the cache has grown too large.
+class DecodedTextureCache
+{
+public:
+  struct Key
+  {
+    // Hash of the texture data of all levels
+    u64 data_hash;
+    // Hash of the palette, or 0 if the format doesn't use one
+    u64 tlut_hash;
+    TextureFormat format;
+    TLUTFormat tlut_format;
+    u32 expanded_width;
+    u32 expanded_height;
+    u32 levels;
+  };
+
+  DecodedTextureCache();
+  DecodedTextureCache(const DecodedTextureCache&) = delete;
+  DecodedTextureCache& operator=(const DecodedTextureCache&) = delete;
+  ~DecodedTextureCache();
+
+  void Open();
+  void Close();
+  bool IsOpen() const { return m_open; }
+
+  // Reads the decoded levels of a texture into dst, which must be exactly as large as the entry.
+  // Returns false if the texture isn't in the cache.
+  bool Read(const Key& key, u8* dst, size_t size);
+
+  // Adds the decoded levels of a texture to the cache. The file is written in the background.
+  void Write(const Key& key, const u8* data, size_t size);
+
+private:
+  struct WriteEntry
+  {
+    std::string filename;
+    std::vector<u8> data;
+  };
+  struct MarkEntryUsed
+  {
+    std::string filename;
+  };
+  struct Prune
+  {
+  };
+  // Everything that touches the disk, apart from reading entries, is done on the background thread.
+  using Job = std::variant<WriteEntry, MarkEntryUsed, Prune>;
+
+  static std::string GetFileName(const Key& key);
+  void RunJob(const Job& job) const;
+  void WriteFile(const WriteEntry& write) const;
+  void PruneEntries() const;
+
+  std::string m_directory;
+  bool m_open = false;
+  // Names of the entries on disk. Entries written by other instances after Open are missed.
+  std::unordered_set<std::string> m_entries;
+  // Names of the entries that have been read since Open, which only need to be marked once.
+  std::unordered_set<std::string> m_used_entries;
+  Common::WorkQueueThreadSP<Job> m_write_thread;
+};
+}  // namespace VideoCommon
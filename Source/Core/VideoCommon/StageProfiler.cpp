@@ -0,0 +1,41 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/StageProfiler.h"
+
+namespace StageProfiler
+{
+std::atomic<bool> g_enabled = false;
+
+// The stages can run on the CPU thread as well as the GPU thread, depending on the settings.
+static Common::EnumMap<std::atomic<s64>, Stage::ShaderUid> s_time_ns;
+static std::atomic<u64> s_rasterized_pixels = 0;
+
+void SetEnabled(bool enabled)
+{
+  TakeTotals();
+  g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void AddTime(Stage stage, std::chrono::nanoseconds time)
+{
+  s_time_ns[stage].fetch_add(time.count(), std::memory_order_relaxed);
+}
+
+void AddRasterizedPixels(u64 pixels)
+{
+  s_rasterized_pixels.fetch_add(pixels, std::memory_order_relaxed);
+}
+
+Totals TakeTotals()
+{
+  Totals totals;
+  for (size_t i = 0; i < s_time_ns.size(); ++i)
+  {
+    totals.time[static_cast<Stage>(i)] =
+        std::chrono::nanoseconds(s_time_ns[static_cast<Stage>(i)].exchange(0));
+  }
+  totals.rasterized_pixels = s_rasterized_pixels.exchange(0);
+  return totals;
+}
+}  // namespace StageProfiler
@@ -0,0 +1,69 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+
+// Measures how much time GPU emulation spends in some of its stages, for benchmarking. It's
+// disabled by default, in which case a ScopedTimer costs a single branch.
+namespace StageProfiler
+{
+enum class Stage
+{
+  // Includes all of the other stages, since they're only ever reached through the opcode decoder
+  OpcodeDecoder,
+  VertexLoader,
+  TextureDecode,
+  ShaderUid,
+};
+
+struct Totals
+{
+  Common::EnumMap<std::chrono::nanoseconds, Stage::ShaderUid> time{};
+  u64 rasterized_pixels = 0;
+};
+
+extern std::atomic<bool> g_enabled;
+
+inline bool IsEnabled()
+{
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+void SetEnabled(bool enabled);
+
+void AddTime(Stage stage, std::chrono::nanoseconds time);
+// Only counted by the software renderer.
+void AddRasterizedPixels(u64 pixels);
+
+// Returns what has been accumulated since the last call, and starts over.
+Totals TakeTotals();
+
+class ScopedTimer
+{
+public:
+  explicit ScopedTimer(Stage stage) : m_stage(stage), m_enabled(IsEnabled())
+  {
+    if (m_enabled)
+      m_start = std::chrono::steady_clock::now();
+  }
+  ~ScopedTimer()
+  {
+    if (m_enabled)
+      AddTime(m_stage, std::chrono::steady_clock::now() - m_start);
+  }
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+  Stage m_stage;
+  bool m_enabled;
+  std::chrono::steady_clock::time_point m_start;
+};
+}  // namespace StageProfiler
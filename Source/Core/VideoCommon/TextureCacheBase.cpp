@@ -49,6 +49,7 @@
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Resources/CustomResourceManager.h"
 #include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/StageProfiler.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureConversionShader.h"
@@ -62,6 +63,8 @@ static const u64 TEXHASH_INVALID = 0;
 // Sonic the Fighters (inside Sonic Gems Collection) loops a 64 frames animation
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
+// Textures are decoded into the temporary buffer, and the AVX2 decoders store 32 bytes at a time.
+static const size_t TEMP_BUFFER_ALIGNMENT = 32;
 
 static int xfb_count = 0;
 
@@ -81,6 +84,39 @@ TCacheEntry::~TCacheEntry()
   g_texture_cache->ReleaseToPool(this);
 }
 
+// Unless the texture cache accuracy is set to safe, large textures are only hashed partially.
+// That's not good enough for entries that outlive the session, so all of the data is hashed if
+// needed.
+static VideoCommon::DecodedTextureCache::Key
+GetDecodedTextureCacheKey(const TextureInfo& texture_info, u64 base_hash, bool is_full_hash)
+{
+  u64 data_hash =
+      is_full_hash ? base_hash :
+                     Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(), 0);
+  for (const auto& mip_level : texture_info.GetMipMapLevels())
+  {
+    if (mip_level.IsDataValid())
+    {
+      data_hash = data_hash * 31 +
+                  Common::GetHash64(mip_level.GetData(), mip_level.GetTextureSize(), 0);
+    }
+  }
+
+  const std::optional<u32> palette_size = texture_info.GetPaletteSize();
+  const u64 tlut_hash =
+      palette_size ? Common::GetHash64(texture_info.GetTlutAddress(), *palette_size, 0) : 0;
+
+  return {
+      .data_hash = data_hash,
+      .tlut_hash = tlut_hash,
+      .format = texture_info.GetTextureFormat(),
+      .tlut_format = palette_size ? texture_info.GetTlutFormat() : TLUTFormat{},
+      .expanded_width = texture_info.GetExpandedWidth(),
+      .expanded_height = texture_info.GetExpandedHeight(),
+      .levels = texture_info.GetLevelCount(),
+  };
+}
+
 void TextureCacheBase::CheckTempSize(size_t required_size)
 {
   if (required_size <= m_temp_size)
@@ -88,15 +124,18 @@ void TextureCacheBase::CheckTempSize(size_t required_size)
 
   m_temp_size = required_size;
   Common::FreeAlignedMemory(m_temp);
-  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
+  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, TEMP_BUFFER_ALIGNMENT));
 }
 
 TextureCacheBase::TextureCacheBase()
 {
   SetBackupConfig(g_ActiveConfig);
 
+  if (g_ActiveConfig.bDecodedTextureCache)
+    m_decoded_texture_cache.Open();
+
   m_temp_size = 2048 * 2048 * 4;
-  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
+  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, TEMP_BUFFER_ALIGNMENT));
 
   TexDecoder_SetTexFmtOverlayOptions(m_backup_config.texfmt_overlay,
                                      m_backup_config.texfmt_overlay_center);
@@ -153,6 +192,14 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     HiresTexture::Update();
   }
 
+  if (config.bDecodedTextureCache != m_backup_config.decoded_texture_cache)
+  {
+    if (config.bDecodedTextureCache)
+      m_decoded_texture_cache.Open();
+    else
+      m_decoded_texture_cache.Close();
+  }
+
   const u32 change_count =
       config.graphics_mod_config ? config.graphics_mod_config->GetChangeCount() : 0;
 
@@ -251,6 +298,7 @@ void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
   m_backup_config.texfmt_overlay_center = config.bTexFmtOverlayCenter;
   m_backup_config.hires_textures = config.bHiresTextures;
   m_backup_config.cache_hires_textures = config.bCacheHiresTextures;
+  m_backup_config.decoded_texture_cache = config.bDecodedTextureCache;
   m_backup_config.stereo_3d = config.stereo_mode != StereoMode::Off;
   m_backup_config.efb_mono_depth = config.bStereoEFBMonoDepth;
   m_backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
@@ -1303,6 +1351,30 @@ TCacheEntry* TextureCacheBase::LoadImpl(u32 stage, bool force_reload)
   return entry.get();
 }
 
+std::optional<u64> TextureCacheBase::FindTrackedHash(const TextureInfo& texture_info,
+                                                     int sample_size) const
+{
+  if (!g_ActiveConfig.bTextureCacheWriteTracking || texture_info.IsFromTmem())
+    return std::nullopt;
+
+  const auto iter_range = m_textures_by_address.equal_range(texture_info.GetRawAddress());
+  for (auto iter = iter_range.first; iter != iter_range.second; ++iter)
+  {
+    // The entry's hash must have been calculated the same way this one would be.
+    const TCacheEntry& entry = *iter->second;
+    if (entry.IsCopy() || entry.size_in_bytes != texture_info.GetTextureSize() ||
+        entry.memory_stride != entry.BytesPerRow() || entry.HashSampleSize() != sample_size)
+    {
+      continue;
+    }
+
+    if (const std::optional<u64> hash = entry.GetTrackedHash())
+      return hash;
+  }
+
+  return std::nullopt;
+}
+
 RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize,
                                            const TextureInfo& texture_info)
 {
@@ -1339,8 +1411,16 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  if (const std::optional<u64> tracked_hash =
+          FindTrackedHash(texture_info, textureCacheSafetyColorSampleSize))
+  {
+    base_hash = *tracked_hash;
+  }
+  else
+  {
+    base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
+                                  textureCacheSafetyColorSampleSize);
+  }
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
@@ -1673,6 +1753,18 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
 
+    // The format overlay is drawn into the decoded data, so it mustn't end up in the disk cache.
+    std::optional<VideoCommon::DecodedTextureCache::Key> disk_cache_key;
+    bool loaded_from_disk_cache = false;
+    // Set if every level has already been decoded to dst_buffer, by the disk cache or at once
+    bool decoded_all_levels = false;
+    if (!decode_on_gpu && !texture_info.IsFromTmem() && m_decoded_texture_cache.IsOpen() &&
+        !m_backup_config.texfmt_overlay)
+    {
+      disk_cache_key = GetDecodedTextureCacheKey(texture_info, creation_info.base_hash,
+                                                 safety_color_sample_size == 0);
+    }
+
     if (!decode_on_gpu ||
         !DecodeTextureOnGPU(
             entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
@@ -1700,14 +1792,62 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
       CheckTempSize(total_texture_size);
       dst_buffer = m_temp;
+
+      if (disk_cache_key)
+      {
+        size_t decoded_levels_size = decoded_texture_size;
+        for (const auto& mip_level : texture_info.GetMipMapLevels())
+        {
+          if (mip_level.IsDataValid())
+          {
+            decoded_levels_size +=
+                mip_level.GetExpandedWidth() * sizeof(u32) * mip_level.GetExpandedHeight();
+          }
+        }
+        loaded_from_disk_cache =
+            m_decoded_texture_cache.Read(*disk_cache_key, dst_buffer, decoded_levels_size);
+      }
+
+      decoded_all_levels = loaded_from_disk_cache;
+      if (!decoded_all_levels && !decode_on_gpu &&
+          !(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
+      {
+        // Hand all levels to the decoder at once, so that it can spread them across threads.
+        std::vector<TextureDecodeLevel> levels;
+        levels.reserve(texture_info.GetLevelCount());
+        levels.push_back({dst_buffer, texture_info.GetData(), static_cast<int>(expanded_width),
+                          static_cast<int>(expanded_height)});
+        u8* level_dst = dst_buffer + decoded_texture_size;
+        for (const auto& mip_level : texture_info.GetMipMapLevels())
+        {
+          if (!mip_level.IsDataValid())
+            continue;
+
+          levels.push_back({level_dst, mip_level.GetData(),
+                            static_cast<int>(mip_level.GetExpandedWidth()),
+                            static_cast<int>(mip_level.GetExpandedHeight())});
+          level_dst += mip_level.GetExpandedWidth() * sizeof(u32) * mip_level.GetExpandedHeight();
+        }
+
+        StageProfiler::ScopedTimer timer(StageProfiler::Stage::TextureDecode);
+        TexDecoder_DecodeLevels(levels, texture_info.GetTextureFormat(),
+                                texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        decoded_all_levels = true;
+      }
+
       if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        if (!decoded_all_levels)
+        {
+          StageProfiler::ScopedTimer timer(StageProfiler::Stage::TextureDecode);
+          TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
+                            texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                            texture_info.GetTlutFormat());
+        }
       }
       else
       {
+        StageProfiler::ScopedTimer timer(StageProfiler::Stage::TextureDecode);
         TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
                                        texture_info.GetTmemOddAddress(), expanded_width,
                                        expanded_height);
@@ -1741,9 +1881,13 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level.GetExpandedWidth() * sizeof(u32) * mip_level.GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level.GetData(), mip_level.GetExpandedWidth(),
-                          mip_level.GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        if (!decoded_all_levels)
+        {
+          StageProfiler::ScopedTimer timer(StageProfiler::Stage::TextureDecode);
+          TexDecoder_Decode(dst_buffer, mip_level.GetData(), mip_level.GetExpandedWidth(),
+                            mip_level.GetExpandedHeight(), texture_info.GetTextureFormat(),
+                            texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        }
         entry->texture->Load(mip_level.GetLevel(), mip_level.GetRawWidth(),
                              mip_level.GetRawHeight(), mip_level.GetExpandedWidth(), dst_buffer,
                              decoded_mip_size);
@@ -1755,6 +1899,12 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       }
     }
 
+    if (disk_cache_key && !loaded_from_disk_cache)
+    {
+      m_decoded_texture_cache.Write(*disk_cache_key, m_temp,
+                                    static_cast<size_t>(dst_buffer - m_temp));
+    }
+
     entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
@@ -3066,6 +3216,7 @@ void TCacheEntry::SetXfbCopy(u32 stride)
   is_xfb_copy = true;
   is_xfb_container = false;
   memory_stride = stride;
+  write_tracking_stamp = 0;
 
   ASSERT_MSG(VIDEO, memory_stride >= BytesPerRow(), "Memory stride is too small");
 
@@ -3078,6 +3229,7 @@ void TCacheEntry::SetEfbCopy(u32 stride)
   is_xfb_copy = false;
   is_xfb_container = false;
   memory_stride = stride;
+  write_tracking_stamp = 0;
 
   ASSERT_MSG(VIDEO, memory_stride >= BytesPerRow(), "Memory stride is too small");
 
@@ -3101,18 +3253,39 @@ int TCacheEntry::HashSampleSize() const
   return g_ActiveConfig.iSafeTextureCache_ColorSamples;
 }
 
+std::optional<u64> TCacheEntry::GetTrackedHash() const
+{
+  if (!g_ActiveConfig.bTextureCacheWriteTracking || write_tracking_stamp == 0)
+    return std::nullopt;
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  if (memory.WasWrittenSince(addr, size_in_bytes, write_tracking_stamp))
+    return std::nullopt;
+
+  return tracked_hash;
+}
+
 u64 TCacheEntry::CalculateHash() const
 {
+  if (const std::optional<u64> hash = GetTrackedHash())
+    return *hash;
+
   const u32 bytes_per_row = BytesPerRow();
   const u32 hash_sample_size = HashSampleSize();
 
   // FIXME: textures from tmem won't get the correct hash.
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
+
+  // Start tracking before hashing, so that writes made while hashing aren't missed.
+  write_tracking_stamp =
+      g_ActiveConfig.bTextureCacheWriteTracking ? memory.TrackWrites(addr, size_in_bytes) : 0;
+
   u8* ptr = memory.GetPointerForRange(addr, size_in_bytes);
   if (memory_stride == bytes_per_row)
   {
-    return Common::GetHash64(ptr, size_in_bytes, hash_sample_size);
+    tracked_hash = Common::GetHash64(ptr, size_in_bytes, hash_sample_size);
+    return tracked_hash;
   }
   else
   {
@@ -3134,7 +3307,8 @@ u64 TCacheEntry::CalculateHash() const
       temp_hash = (temp_hash * 397) ^ Common::GetHash64(ptr, bytes_per_row, samples_per_row);
       ptr += memory_stride;
     }
-    return temp_hash;
+    tracked_hash = temp_hash;
+    return tracked_hash;
   }
 }
 
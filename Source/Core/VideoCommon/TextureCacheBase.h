@@ -24,6 +24,7 @@
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/DecodedTextureCache.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
@@ -144,6 +145,12 @@ struct TCacheEntry
 
   bool reference_changed = false;  // used by xfb to determine when a reference xfb changed
 
+  // With write tracking, the result of the last CalculateHash and the stamp of the write tracking
+  // that was started right before it. As long as the backing memory isn't written to, the hash is
+  // still valid and doesn't need to be calculated again.
+  mutable u64 write_tracking_stamp = 0;
+  mutable u64 tracked_hash = 0;
+
   // Texture dimensions from the GameCube's point of view
   u32 native_width = 0;
   u32 native_height = 0;
@@ -183,6 +190,7 @@ struct TCacheEntry
     size_in_bytes = _size;
     format = _format;
     should_force_safe_hashing = force_safe_hashing;
+    write_tracking_stamp = 0;
   }
 
   void SetDimensions(unsigned int _native_width, unsigned int _native_height,
@@ -192,6 +200,7 @@ struct TCacheEntry
     native_height = _native_height;
     native_levels = _native_levels;
     memory_stride = _native_width;
+    write_tracking_stamp = 0;
   }
 
   void SetHashes(u64 _base_hash, u64 _hash)
@@ -229,6 +238,8 @@ struct TCacheEntry
   u32 BytesPerRow() const;
 
   u64 CalculateHash() const;
+  // Returns the hash CalculateHash would return, if write tracking shows it's still valid.
+  std::optional<u64> GetTrackedHash() const;
 
   int HashSampleSize() const;
   u32 GetWidth() const { return texture->GetConfig().width; }
@@ -369,6 +380,10 @@ private:
 
   void CheckTempSize(size_t required_size);
 
+  // Looks for an entry at the texture's address which knows the hash of its data thanks to write
+  // tracking, so that the data doesn't have to be hashed again.
+  std::optional<u64> FindTrackedHash(const TextureInfo& texture_info, int sample_size) const;
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
@@ -430,6 +445,7 @@ private:
     bool texfmt_overlay_center;
     bool hires_textures;
     bool cache_hires_textures;
+    bool decoded_texture_cache;
     bool copy_cache_enable;
     bool stereo_3d;
     bool efb_mono_depth;
@@ -467,6 +483,7 @@ private:
       GetVideoEvents().after_frame_event.Register([this](Core::System&) { OnFrameEnd(); });
 
   VideoCommon::TextureUtils::TextureDumper m_texture_dumper;
+  VideoCommon::DecodedTextureCache m_decoded_texture_cache;
 };
 
 extern std::unique_ptr<TextureCacheBase> g_texture_cache;
@@ -189,8 +189,20 @@ int TexDecoder_GetEFBCopyBlockHeightInTexels(EFBCopyFormat format);
 int TexDecoder_GetPaletteSize(TextureFormat fmt);
 TextureFormat TexDecoder_GetEFBCopyBaseFormat(EFBCopyFormat format);
 
+struct TextureDecodeLevel
+{
+  u8* dst;
+  const u8* src;
+  int width;
+  int height;
+};
+
+// Large textures are split into bands of block rows which are decoded in parallel. All levels
+// passed to TexDecoder_DecodeLevels are split and decoded together, small ones included.
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt);
+void TexDecoder_DecodeLevels(std::span<const TextureDecodeLevel> levels, TextureFormat texformat,
+                             const u8* tlut, TLUTFormat tlutfmt);
 void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
                                     int height);
 void TexDecoder_DecodeTexel(u8* dst, std::span<const u8> src, int s, int t, int imageWidth,
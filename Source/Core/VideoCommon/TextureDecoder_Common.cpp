@@ -5,11 +5,13 @@
 #include <array>
 #include <cstddef>
 #include <span>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "Common/SpanUtils.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 
 #include "VideoCommon/LookUpTables.h"
 #include "VideoCommon/TextureDecoder.h"
@@ -19,6 +21,11 @@
 static bool TexFmt_Overlay_Enable = false;
 static bool TexFmt_Overlay_Center = false;
 
+// Handing a band to another thread only pays off if it takes longer to decode than to hand off.
+constexpr int MIN_PARALLEL_DECODE_TEXELS = 64 * 1024;
+// Textures are decoded on the GPU thread, which shouldn't take the CPU thread's cores.
+constexpr size_t MAX_DECODING_THREADS = 3;
+
 // TRAM
 // STATE_TO_SAVE
 alignas(16) std::array<u8, TMEM_SIZE> s_tex_mem;
@@ -297,13 +304,67 @@ static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat
   }
 }
 
+static Common::ThreadPool& GetDecodingThreadPool()
+{
+  static Common::ThreadPool pool(
+      "Texture Decoding",
+      std::min(Common::ThreadPool::GetDefaultThreadCount(), MAX_DECODING_THREADS));
+  return pool;
+}
+
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt)
 {
-  _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  const TextureDecodeLevel level{dst, src, width, height};
+  TexDecoder_DecodeLevels(std::span(&level, 1), texformat, tlut, tlutfmt);
+}
+
+void TexDecoder_DecodeLevels(std::span<const TextureDecodeLevel> levels, TextureFormat texformat,
+                             const u8* tlut, TLUTFormat tlutfmt)
+{
+  int total_texels = 0;
+  for (const TextureDecodeLevel& level : levels)
+    total_texels += level.width * level.height;
+
+  if (total_texels < MIN_PARALLEL_DECODE_TEXELS * 2)
+  {
+    for (const TextureDecodeLevel& level : levels)
+    {
+      _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(level.dst), level.src, level.width,
+                             level.height, texformat, tlut, tlutfmt);
+    }
+  }
+  else
+  {
+    // Blocks are stored row by row, so a band of whole block rows is a contiguous part of both the
+    // source and the destination, and can be decoded as a texture of its own.
+    const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+    std::vector<TextureDecodeLevel> bands;
+    for (const TextureDecodeLevel& level : levels)
+    {
+      const int min_band_height = MIN_PARALLEL_DECODE_TEXELS / std::max(level.width, 1);
+      const int band_height = std::max(
+          block_height, (min_band_height + block_height - 1) / block_height * block_height);
+      for (int y = 0; y < level.height; y += band_height)
+      {
+        bands.push_back({level.dst + y * level.width * sizeof(u32),
+                         level.src + TexDecoder_GetTextureSizeInBytes(level.width, y, texformat),
+                         level.width, std::min(band_height, level.height - y)});
+      }
+    }
+
+    GetDecodingThreadPool().ParallelFor(bands.size(), [&](size_t i) {
+      const TextureDecodeLevel& band = bands[i];
+      _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(band.dst), band.src, band.width, band.height,
+                             texformat, tlut, tlutfmt);
+    });
+  }
 
   if (TexFmt_Overlay_Enable)
-    TexDecoder_DrawOverlay(dst, width, height, texformat);
+  {
+    for (const TextureDecodeLevel& level : levels)
+      TexDecoder_DrawOverlay(level.dst, level.width, level.height, texformat);
+  }
 }
 
 static inline u32 DecodePixel_IA8(u16 val)
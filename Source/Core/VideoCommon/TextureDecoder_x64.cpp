@@ -1409,6 +1409,554 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
   }
 }
 
+// AVX2 decoders. Every 256-bit store writes a whole row of 8 texels: one row of a block for the
+// formats with blocks that are 8 texels wide, and the same row of two horizontally adjacent blocks
+// for the formats with blocks that are 4 texels wide. When a texture of the latter kind is an odd
+// number of blocks wide, the last block of each block row is decoded on its own and only the lower
+// half of its rows is stored.
+
+// Replicates each of the lower 8 bytes of v to all 4 bytes of a 32-bit word.
+FUNCTION_TARGET_AVX2
+static inline __m256i ReplicateBytes_AVX2(__m128i v)
+{
+  const __m256i mask = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4,
+                                        5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+  return _mm256_shuffle_epi8(_mm256_broadcastq_epi64(v), mask);
+}
+
+// Replicates the high nibble of each byte to both of its nibbles, as Convert4To8 does.
+static inline __m128i ExpandHighNibbles(__m128i v)
+{
+  const __m128i high = _mm_and_si128(v, _mm_set1_epi8(static_cast<char>(0xf0)));
+  return _mm_or_si128(high, _mm_srli_epi16(high, 4));
+}
+
+// Replicates the low nibble of each byte to both of its nibbles, as Convert4To8 does.
+static inline __m128i ExpandLowNibbles(__m128i v)
+{
+  const __m128i low = _mm_and_si128(v, _mm_set1_epi8(0x0f));
+  return _mm_or_si128(low, _mm_slli_epi16(low, 4));
+}
+
+// Swaps the bytes of the 16-bit value in the lower half of each 32-bit word.
+FUNCTION_TARGET_AVX2
+static inline __m256i Swap16_AVX2(__m256i v)
+{
+  const __m256i mask = _mm256_setr_epi8(1, 0, -1, -1, 5, 4, -1, -1, 9, 8, -1, -1, 13, 12, -1, -1, 1,
+                                        0, -1, -1, 5, 4, -1, -1, 9, 8, -1, -1, 13, 12, -1, -1);
+  return _mm256_shuffle_epi8(v, mask);
+}
+
+// The DecodePixel_* functions for 8 texels at once. The 16-bit texels are in the lower halves of
+// the 32-bit words, in the byte order of DecodePixel_IA8 and of the swapped values for the others.
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_IA8_AVX2(__m256i val)
+{
+  // (0 0 I A) -> (A I I I)
+  const __m256i mask = _mm256_setr_epi8(1, 1, 1, 0, 5, 5, 5, 4, 9, 9, 9, 8, 13, 13, 13, 12, 1, 1, 1,
+                                        0, 5, 5, 5, 4, 9, 9, 9, 8, 13, 13, 13, 12);
+  return _mm256_shuffle_epi8(val, mask);
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_RGB565_AVX2(__m256i val)
+{
+  // Each component is moved to its byte twice: once for its upper bits, and once more for the
+  // lower bits of the result, which repeat its upper bits.
+  const __m256i r = _mm256_or_si256(
+      _mm256_and_si256(_mm256_srli_epi32(val, 8), _mm256_set1_epi32(0x000000f8)),
+      _mm256_srli_epi32(val, 13));
+  const __m256i g = _mm256_or_si256(
+      _mm256_and_si256(_mm256_slli_epi32(val, 5), _mm256_set1_epi32(0x0000fc00)),
+      _mm256_and_si256(_mm256_srli_epi32(val, 1), _mm256_set1_epi32(0x00000300)));
+  const __m256i b = _mm256_or_si256(
+      _mm256_and_si256(_mm256_slli_epi32(val, 19), _mm256_set1_epi32(0x00f80000)),
+      _mm256_and_si256(_mm256_slli_epi32(val, 14), _mm256_set1_epi32(0x00070000)));
+  return _mm256_or_si256(_mm256_or_si256(r, g),
+                         _mm256_or_si256(b, _mm256_set1_epi32(static_cast<int>(0xff000000))));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_RGB5A3_AVX2(__m256i val)
+{
+  // Both encodings are decoded for every texel, and the MSB picks which one is used. This is
+  // cheaper than branching on whether a group of texels uses only one of them.
+  const __m256i r5 = _mm256_or_si256(
+      _mm256_and_si256(_mm256_srli_epi32(val, 7), _mm256_set1_epi32(0x000000f8)),
+      _mm256_and_si256(_mm256_srli_epi32(val, 12), _mm256_set1_epi32(0x00000007)));
+  const __m256i g5 = _mm256_or_si256(
+      _mm256_and_si256(_mm256_slli_epi32(val, 6), _mm256_set1_epi32(0x0000f800)),
+      _mm256_and_si256(_mm256_slli_epi32(val, 1), _mm256_set1_epi32(0x00000700)));
+  const __m256i b5 = _mm256_or_si256(
+      _mm256_and_si256(_mm256_slli_epi32(val, 19), _mm256_set1_epi32(0x00f80000)),
+      _mm256_and_si256(_mm256_slli_epi32(val, 14), _mm256_set1_epi32(0x00070000)));
+  const __m256i rgb555 =
+      _mm256_or_si256(_mm256_or_si256(r5, g5),
+                      _mm256_or_si256(b5, _mm256_set1_epi32(static_cast<int>(0xff000000))));
+
+  const __m256i r4 = _mm256_or_si256(
+      _mm256_and_si256(_mm256_srli_epi32(val, 4), _mm256_set1_epi32(0x000000f0)),
+      _mm256_and_si256(_mm256_srli_epi32(val, 8), _mm256_set1_epi32(0x0000000f)));
+  const __m256i g4 = _mm256_or_si256(
+      _mm256_and_si256(_mm256_slli_epi32(val, 8), _mm256_set1_epi32(0x0000f000)),
+      _mm256_and_si256(_mm256_slli_epi32(val, 4), _mm256_set1_epi32(0x00000f00)));
+  const __m256i b4 = _mm256_or_si256(
+      _mm256_and_si256(_mm256_slli_epi32(val, 20), _mm256_set1_epi32(0x00f00000)),
+      _mm256_and_si256(_mm256_slli_epi32(val, 16), _mm256_set1_epi32(0x000f0000)));
+  // Swizzle bits: 00000123 -> 12312312
+  const __m256i a3 = _mm256_or_si256(
+      _mm256_and_si256(_mm256_slli_epi32(val, 17), _mm256_set1_epi32(static_cast<int>(0xe0000000))),
+      _mm256_or_si256(
+          _mm256_and_si256(_mm256_slli_epi32(val, 14), _mm256_set1_epi32(0x1c000000)),
+          _mm256_and_si256(_mm256_slli_epi32(val, 11), _mm256_set1_epi32(0x03000000))));
+  const __m256i rgba4443 = _mm256_or_si256(_mm256_or_si256(r4, g4), _mm256_or_si256(b4, a3));
+
+  const __m256i is_rgb555 = _mm256_srai_epi32(_mm256_slli_epi32(val, 16), 31);
+  return _mm256_blendv_epi8(rgba4443, rgb555, is_rgb555);
+}
+
+// Decodes 8 palette entries, as read from the TLUT into the lower halves of 32-bit words.
+template <TLUTFormat tlutfmt>
+FUNCTION_TARGET_AVX2 static inline __m256i DecodePaletteEntries_AVX2(__m256i entries)
+{
+  if constexpr (tlutfmt == TLUTFormat::IA8)
+    return DecodePixels_IA8_AVX2(entries);
+  else if constexpr (tlutfmt == TLUTFormat::RGB565)
+    return DecodePixels_RGB565_AVX2(Swap16_AVX2(entries));
+  else
+    return DecodePixels_RGB5A3_AVX2(Swap16_AVX2(entries));
+}
+
+// Decodes a texture made of 4x4 blocks of 16-bit texels. DecodeTexels is given the same row of two
+// horizontally adjacent blocks, 8 texels in the order they are stored in.
+template <__m256i (*DecodeTexels)(__m128i texels, const u8* tlut)>
+FUNCTION_TARGET_AVX2 static void DecodeBlocks16_AVX2(u32* dst, const u8* src, int width,
+                                                     int height, const u8* tlut, int Wsteps4)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 8, yStep += 2)
+    {
+      const bool both_blocks = x + 4 < width;
+      const u8* block0 = src + 32 * yStep;
+      const u8* block1 = both_blocks ? block0 + 32 : block0;
+      for (int iy = 0; iy < 4; iy++)
+      {
+        const __m128i texels =
+            _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(block0 + 8 * iy)),
+                               _mm_loadl_epi64((const __m128i*)(block1 + 8 * iy)));
+        const __m256i rgba = DecodeTexels(texels, tlut);
+        u32* row = dst + (y + iy) * width + x;
+        if (both_blocks)
+          _mm256_storeu_si256((__m256i*)row, rgba);
+        else
+          _mm_storeu_si128((__m128i*)row, _mm256_castsi256_si128(rgba));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeTexels_IA8_AVX2(__m128i texels, const u8* tlut)
+{
+  return DecodePixels_IA8_AVX2(_mm256_cvtepu16_epi32(texels));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeTexels_RGB565_AVX2(__m128i texels, const u8* tlut)
+{
+  return DecodePixels_RGB565_AVX2(Swap16_AVX2(_mm256_cvtepu16_epi32(texels)));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeTexels_RGB5A3_AVX2(__m128i texels, const u8* tlut)
+{
+  return DecodePixels_RGB5A3_AVX2(Swap16_AVX2(_mm256_cvtepu16_epi32(texels)));
+}
+
+template <TLUTFormat tlutfmt>
+FUNCTION_TARGET_AVX2 static inline __m256i DecodeTexels_C14X2_AVX2(__m128i texels, const u8* tlut)
+{
+  const __m256i index =
+      _mm256_and_si256(Swap16_AVX2(_mm256_cvtepu16_epi32(texels)), _mm256_set1_epi32(0x3fff));
+  // Gathering the 32 bits at each entry would read past the end of the palette for the last entry,
+  // so the aligned pair of entries that contains it is gathered instead.
+  const __m256i pairs =
+      _mm256_i32gather_epi32((const int*)tlut, _mm256_srli_epi32(index, 1), sizeof(u32));
+  const __m256i shift = _mm256_slli_epi32(_mm256_and_si256(index, _mm256_set1_epi32(1)), 4);
+  const __m256i entries =
+      _mm256_and_si256(_mm256_srlv_epi32(pairs, shift), _mm256_set1_epi32(0xffff));
+  return DecodePaletteEntries_AVX2<tlutfmt>(entries);
+}
+
+template <TLUTFormat tlutfmt>
+FUNCTION_TARGET_AVX2 static void DecodeC4_AVX2(u32* dst, const u8* src, int width, int height,
+                                               const u8* tlut, int Wsteps8)
+{
+  // All 16 entries of the palette fit in two registers, so texels are looked up with permutes.
+  const __m256i palette_low = DecodePaletteEntries_AVX2<tlutfmt>(
+      _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)tlut)));
+  const __m256i palette_high = DecodePaletteEntries_AVX2<tlutfmt>(
+      _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)tlut + 1)));
+  // The first texel of each byte is in its high nibble.
+  const __m256i shift = _mm256_setr_epi32(4, 0, 4, 0, 4, 0, 4, 0);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 8; iy += 2, xStep++)
+      {
+        // Two rows of 4 bytes, with each byte doubled so that there is one for every texel.
+        const __m128i r = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        const __m128i bytes = _mm_unpacklo_epi8(r, r);
+        for (int row = 0; row < 2; row++)
+        {
+          const __m256i index = _mm256_and_si256(
+              _mm256_srlv_epi32(_mm256_cvtepu8_epi32(row == 0 ? bytes : _mm_srli_si128(bytes, 8)),
+                                shift),
+              _mm256_set1_epi32(0xf));
+          const __m256i rgba = _mm256_blendv_epi8(
+              _mm256_permutevar8x32_epi32(palette_low, index),
+              _mm256_permutevar8x32_epi32(palette_high, index),
+              _mm256_cmpgt_epi32(index, _mm256_set1_epi32(7)));
+          _mm256_storeu_si256((__m256i*)(dst + (y + iy + row) * width + x), rgba);
+        }
+      }
+    }
+  }
+}
+
+template <TLUTFormat tlutfmt>
+FUNCTION_TARGET_AVX2 static void DecodeC8_AVX2(u32* dst, const u8* src, int width, int height,
+                                               const u8* tlut, int Wsteps8)
+{
+  // Decode the whole palette up front, so that texels are looked up with plain gathers.
+  alignas(32) u32 palette[256];
+  for (int i = 0; i < 256; i += 8)
+  {
+    const __m256i entries =
+        _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(tlut + i * sizeof(u16))));
+    _mm256_store_si256((__m256i*)(palette + i), DecodePaletteEntries_AVX2<tlutfmt>(entries));
+  }
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i index =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        const __m256i rgba = _mm256_i32gather_epi32((const int*)palette, index, sizeof(u32));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), rgba);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::RGB5A3:
+    DecodeC4_AVX2<TLUTFormat::RGB5A3>(dst, src, width, height, tlut, Wsteps8);
+    break;
+
+  case TLUTFormat::IA8:
+    DecodeC4_AVX2<TLUTFormat::IA8>(dst, src, width, height, tlut, Wsteps8);
+    break;
+
+  case TLUTFormat::RGB565:
+    DecodeC4_AVX2<TLUTFormat::RGB565>(dst, src, width, height, tlut, Wsteps8);
+    break;
+
+  default:
+    break;
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 2 * yStep; iy < 8; iy += 4, xStep++)
+      {
+        // Four rows of 4 bytes. The first texel of each byte is in its high nibble.
+        const __m128i r = _mm_loadu_si128((const __m128i*)(src + 16 * xStep));
+        const __m128i high = ExpandHighNibbles(r);
+        const __m128i low = ExpandLowNibbles(r);
+        const __m128i i01 = _mm_unpacklo_epi8(high, low);
+        const __m128i i23 = _mm_unpackhi_epi8(high, low);
+
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), ReplicateBytes_AVX2(i01));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy + 1) * width + x),
+                            ReplicateBytes_AVX2(_mm_srli_si128(i01, 8)));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy + 2) * width + x), ReplicateBytes_AVX2(i23));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy + 3) * width + x),
+                            ReplicateBytes_AVX2(_mm_srli_si128(i23, 8)));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m128i r = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), ReplicateBytes_AVX2(r));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::RGB5A3:
+    DecodeC8_AVX2<TLUTFormat::RGB5A3>(dst, src, width, height, tlut, Wsteps8);
+    break;
+
+  case TLUTFormat::IA8:
+    DecodeC8_AVX2<TLUTFormat::IA8>(dst, src, width, height, tlut, Wsteps8);
+    break;
+
+  case TLUTFormat::RGB565:
+    DecodeC8_AVX2<TLUTFormat::RGB565>(dst, src, width, height, tlut, Wsteps8);
+    break;
+
+  default:
+    break;
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA4_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // (i0 i1 ... i7 a0 a1 ... a7) -> (a0 i0 i0 i0 ... a7 i7 i7 i7)
+  const __m256i mask = _mm256_setr_epi8(0, 0, 0, 8, 1, 1, 1, 9, 2, 2, 2, 10, 3, 3, 3, 11, 4, 4, 4,
+                                        12, 5, 5, 5, 13, 6, 6, 6, 14, 7, 7, 7, 15);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 2 * yStep; iy < 4; iy += 2, xStep++)
+      {
+        // Two rows of 8 bytes, with the alpha in the high nibble of each byte.
+        const __m128i r = _mm_loadu_si128((const __m128i*)(src + 16 * xStep));
+        const __m128i a = ExpandHighNibbles(r);
+        const __m128i i = ExpandLowNibbles(r);
+        const __m256i ia0 = _mm256_broadcastsi128_si256(_mm_unpacklo_epi64(i, a));
+        const __m256i ia1 = _mm256_broadcastsi128_si256(_mm_unpackhi_epi64(i, a));
+
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_shuffle_epi8(ia0, mask));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy + 1) * width + x),
+                            _mm256_shuffle_epi8(ia1, mask));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  DecodeBlocks16_AVX2<DecodeTexels_IA8_AVX2>(dst, src, width, height, tlut, Wsteps4);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C14X2_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::RGB5A3:
+    DecodeBlocks16_AVX2<DecodeTexels_C14X2_AVX2<TLUTFormat::RGB5A3>>(dst, src, width, height, tlut,
+                                                                     Wsteps4);
+    break;
+
+  case TLUTFormat::IA8:
+    DecodeBlocks16_AVX2<DecodeTexels_C14X2_AVX2<TLUTFormat::IA8>>(dst, src, width, height, tlut,
+                                                                  Wsteps4);
+    break;
+
+  case TLUTFormat::RGB565:
+    DecodeBlocks16_AVX2<DecodeTexels_C14X2_AVX2<TLUTFormat::RGB565>>(dst, src, width, height, tlut,
+                                                                     Wsteps4);
+    break;
+
+  default:
+    break;
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB565_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  DecodeBlocks16_AVX2<DecodeTexels_RGB565_AVX2>(dst, src, width, height, tlut, Wsteps4);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  DecodeBlocks16_AVX2<DecodeTexels_RGB5A3_AVX2>(dst, src, width, height, tlut, Wsteps4);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGBA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // (A G R B) -> (R G B A), see TexDecoder_DecodeImpl_RGBA8_SSSE3
+  const __m256i mask0312 = _mm256_setr_epi8(2, 1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12, 2,
+                                            1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 8, yStep += 2)
+    {
+      const bool both_blocks = x + 4 < width;
+      const u8* block0 = src + 64 * yStep;
+      const u8* block1 = both_blocks ? block0 + 64 : block0;
+      const __m256i ar0 = _mm256_loadu_si256((const __m256i*)block0);
+      const __m256i gb0 = _mm256_loadu_si256((const __m256i*)(block0 + 32));
+      const __m256i ar1 = _mm256_loadu_si256((const __m256i*)block1);
+      const __m256i gb1 = _mm256_loadu_si256((const __m256i*)(block1 + 32));
+
+      // Rows 0 and 2 of a block end up in the lower and upper lanes, and so do rows 1 and 3.
+      const __m256i rgba02_0 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar0, gb0), mask0312);
+      const __m256i rgba13_0 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar0, gb0), mask0312);
+      const __m256i rgba02_1 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar1, gb1), mask0312);
+      const __m256i rgba13_1 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar1, gb1), mask0312);
+
+      const __m256i rows[4] = {
+          _mm256_permute2x128_si256(rgba02_0, rgba02_1, 0x20),
+          _mm256_permute2x128_si256(rgba13_0, rgba13_1, 0x20),
+          _mm256_permute2x128_si256(rgba02_0, rgba02_1, 0x31),
+          _mm256_permute2x128_si256(rgba13_0, rgba13_1, 0x31),
+      };
+      for (int iy = 0; iy < 4; iy++)
+      {
+        u32* row = dst + (y + iy) * width + x;
+        if (both_blocks)
+          _mm256_storeu_si256((__m256i*)row, rows[iy]);
+        else
+          _mm_storeu_si128((__m128i*)row, _mm256_castsi256_si128(rows[iy]));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_CMPR_AVX2(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i zero = _mm256_setzero_si256();
+  // The alpha channel of each color, when the channels are 16-bit values.
+  const __m256i alpha_mask = _mm256_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1);
+  // Selectors are stored from the left texel to the right one in the bits of each byte, and the
+  // 4 colors of the right block come after those of the left one.
+  const __m256i selector_shift = _mm256_setr_epi32(6, 4, 2, 0, 6, 4, 2, 0);
+  const __m256i right_block = _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      // All 4 DXT blocks of the tile are decoded at once, the top ones in the lower lane and the
+      // bottom ones in the upper lane.
+      const __m256i dxt = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep));
+
+      // The two big-endian colors of each block, as (c0 c1 c0 c1) for the two blocks of a lane.
+      const __m256i colors = _mm256_shuffle_epi8(
+          dxt, _mm256_setr_epi8(1, 0, -1, -1, 3, 2, -1, -1, 9, 8, -1, -1, 11, 10, -1, -1, 1, 0, -1,
+                                -1, 3, 2, -1, -1, 9, 8, -1, -1, 11, 10, -1, -1));
+      const __m256i rgb01 = DecodePixels_RGB565_AVX2(colors);
+
+      // (c0 of the left block, c0 of the right block), and the same for c1.
+      const __m256i color0 = _mm256_shuffle_epi32(colors, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256i color1 = _mm256_shuffle_epi32(colors, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256i c0_greater = _mm256_cmpgt_epi32(color0, color1);
+      // One mask for each of the 16-bit channels of the left and the right block.
+      const __m256i blend = _mm256_unpacklo_epi32(c0_greater, c0_greater);
+
+      // The channels of both colors, as 16-bit values.
+      const __m256i rgb0 =
+          _mm256_unpacklo_epi8(_mm256_shuffle_epi32(rgb01, _MM_SHUFFLE(2, 0, 2, 0)), zero);
+      const __m256i rgb1 =
+          _mm256_unpacklo_epi8(_mm256_shuffle_epi32(rgb01, _MM_SHUFFLE(3, 1, 3, 1)), zero);
+      // See DXTBlend. The alpha stays at 0xFF.
+      const __m256i five = _mm256_set1_epi16(5);
+      const __m256i three = _mm256_set1_epi16(3);
+      const __m256i rgb2_blend = _mm256_srli_epi16(
+          _mm256_add_epi16(_mm256_mullo_epi16(rgb0, five), _mm256_mullo_epi16(rgb1, three)), 3);
+      const __m256i rgb3_blend = _mm256_srli_epi16(
+          _mm256_add_epi16(_mm256_mullo_epi16(rgb0, three), _mm256_mullo_epi16(rgb1, five)), 3);
+      // Otherwise, both are the average of the colors, and the second one is transparent.
+      const __m256i rgb_average = _mm256_srli_epi16(_mm256_add_epi16(rgb0, rgb1), 1);
+      const __m256i rgb2 = _mm256_blendv_epi8(rgb_average, rgb2_blend, blend);
+      const __m256i rgb3 = _mm256_blendv_epi8(
+          _mm256_andnot_si256(alpha_mask, rgb_average), rgb3_blend, blend);
+
+      // (c2 of the left block, c2 of the right block, c3 of the left block, c3 of the right block)
+      // -> (c2 c3 of the left block, c2 c3 of the right block)
+      const __m256i rgb23 =
+          _mm256_shuffle_epi32(_mm256_packus_epi16(rgb2, rgb3), _MM_SHUFFLE(3, 1, 2, 0));
+      const __m256i palette_left = _mm256_unpacklo_epi64(rgb01, rgb23);
+      const __m256i palette_right = _mm256_unpackhi_epi64(rgb01, rgb23);
+      const __m256i palettes[2] = {
+          _mm256_permute2x128_si256(palette_left, palette_right, 0x20),
+          _mm256_permute2x128_si256(palette_left, palette_right, 0x31),
+      };
+
+      for (int z = 0; z < 2; z++)
+      {
+        // The selectors of the left block in the lower 4 words, those of the right one in the
+        // upper 4 words, with one byte for each row.
+        __m256i selectors = _mm256_permutevar8x32_epi32(
+            dxt, z == 0 ? _mm256_setr_epi32(1, 1, 1, 1, 3, 3, 3, 3) :
+                          _mm256_setr_epi32(5, 5, 5, 5, 7, 7, 7, 7));
+        for (int iy = 0; iy < 4; iy++)
+        {
+          const __m256i index = _mm256_or_si256(
+              _mm256_and_si256(_mm256_srlv_epi32(selectors, selector_shift), _mm256_set1_epi32(3)),
+              right_block);
+          _mm256_storeu_si256((__m256i*)(dst + (y + z * 4 + iy) * width + x),
+                              _mm256_permutevar8x32_epi32(palettes[z], index));
+          selectors = _mm256_srli_epi32(selectors, 8);
+        }
+      }
+    }
+  }
+}
+
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
@@ -1418,11 +1966,18 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I4_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1430,7 +1985,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1438,15 +1996,27 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
-    TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else
+      TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                Wsteps8);
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1455,17 +2025,28 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C14X2:
-    TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C14X2_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                  Wsteps8);
     break;
 
   case TextureFormat::RGB565:
-    TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                 Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB565_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else
+      TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                   Wsteps8);
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1474,7 +2055,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGBA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGBA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGBA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                         Wsteps8);
     else
@@ -1483,7 +2067,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::CMPR:
-    TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_CMPR_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                      Wsteps8);
+    else
+      TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                 Wsteps8);
     break;
 
   case TextureFormat::XFB:
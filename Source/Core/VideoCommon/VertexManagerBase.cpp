@@ -34,6 +34,7 @@
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/StageProfiler.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -797,6 +798,8 @@ void VertexManagerBase::CalculateNormals(NativeVertexFormat* format)
 
 void VertexManagerBase::UpdatePipelineConfig()
 {
+  StageProfiler::ScopedTimer timer(StageProfiler::Stage::ShaderUid);
+
   NativeVertexFormat* vertex_format = VertexLoaderManager::GetCurrentVertexFormat();
   if (vertex_format != m_current_pipeline_config.vertex_format)
   {
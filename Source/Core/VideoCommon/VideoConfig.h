@@ -269,6 +269,7 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  bool bDecodedTextureCache = false;
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bBorderlessFullscreen = false;
@@ -293,6 +294,7 @@ struct VideoConfig final
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
   int iSafeTextureCache_ColorSamples = 0;
+  bool bTextureCacheWriteTracking = false;
   float fAspectRatioHackW = 1;  // Initial value needed for the first frame
   float fAspectRatioHackH = 1;
   bool bEnablePixelLighting = false;
@@ -0,0 +1,64 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/ThreadPool.h"
+
+TEST(ThreadPool, PushAndWait)
+{
+  Common::ThreadPool pool;
+
+  constexpr int ITEM_COUNT = 1000;
+
+  std::atomic<int> sum = 0;
+  pool.Push([&] { sum += 1; });
+  pool.WaitForCompletion();
+  // Still zero because it's not running.
+  EXPECT_EQ(sum, 0);
+
+  pool.Reset("test pool", 4);
+  pool.WaitForCompletion();
+  // Items pushed before Reset are processed.
+  EXPECT_EQ(sum, 1);
+
+  for (int i = 0; i != ITEM_COUNT; ++i)
+    pool.Push([&] { sum += 1; });
+  pool.WaitForCompletion();
+  EXPECT_EQ(sum, ITEM_COUNT + 1);
+
+  for (int i = 0; i != ITEM_COUNT; ++i)
+    pool.Push([&] { sum += 1; });
+  // Shutdown finishes the queued work.
+  pool.Shutdown();
+  EXPECT_EQ(sum, 2 * ITEM_COUNT + 1);
+  EXPECT_EQ(pool.GetThreadCount(), 0u);
+}
+
+TEST(ThreadPool, ParallelFor)
+{
+  constexpr size_t ITEM_COUNT = 10000;
+
+  for (size_t thread_count : {0, 1, 3})
+  {
+    Common::ThreadPool pool("test pool", thread_count);
+
+    std::vector<int> visits(ITEM_COUNT);
+    pool.ParallelFor(ITEM_COUNT, [&](size_t i) { ++visits[i]; });
+
+    for (size_t i = 0; i != ITEM_COUNT; ++i)
+      EXPECT_EQ(visits[i], 1);
+  }
+}
+
+TEST(ThreadPool, NestedParallelFor)
+{
+  Common::ThreadPool pool("test pool", 2);
+
+  std::atomic<int> sum = 0;
+  pool.ParallelFor(8, [&](size_t) { pool.ParallelFor(8, [&](size_t) { sum += 1; }); });
+  EXPECT_EQ(sum, 64);
+}
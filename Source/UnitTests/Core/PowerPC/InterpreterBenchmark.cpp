@@ -0,0 +1,95 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstring>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/Assembler/GekkoAssembler.h"
+#include "Common/CommonTypes.h"
+#include "Common/ScopeGuard.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace
+{
+// Translation is off, so these are physical addresses in MEM1.
+constexpr u32 CODE_ADDRESS = 0x00010000;
+constexpr u32 DATA_ADDRESS = 0x00020000;
+
+constexpr int STEPS = 10'000'000;
+
+// A loop of integer, load/store, floating point and paired single instructions, which between
+// them go through every level of the interpreter's opcode tables.
+constexpr char LOOP[] = R"(
+loop:
+  addi 3, 3, 1
+  add 4, 4, 3
+  rlwinm 5, 4, 3, 0, 28
+  lwz 6, 0(7)
+  stw 4, 4(7)
+  xor 8, 6, 5
+  mullw 9, 8, 3
+  subf 10, 3, 4
+  fadd 1, 1, 2
+  fmuls 3, 1, 2
+  ps_add 4, 4, 5
+  ps_madd 6, 4, 5, 6
+  cmpw 3, 9
+  crxor 6, 6, 6
+  b loop
+)";
+
+double MeasureStepsPerSecond(Interpreter& interpreter, PowerPC::PowerPCState& ppc_state)
+{
+  ppc_state.pc = CODE_ADDRESS;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < STEPS; ++i)
+    interpreter.SingleStepInner();
+  const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+  return STEPS / time.count();
+}
+}  // namespace
+
+TEST(InterpreterBenchmark, StepsPerSecond)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  Core::System& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+  memory.Init();
+  Common::ScopeGuard memory_guard([&memory] { memory.Shutdown(); });
+
+  auto assembled = Common::GekkoAssembler::Assemble(LOOP, CODE_ADDRESS);
+  ASSERT_FALSE(IsFailure(assembled));
+  const std::vector<u8>& code = GetT(assembled)[0].instructions;
+  std::memcpy(memory.GetRAM() + CODE_ADDRESS, code.data(), code.size());
+
+  // Run without address translation, with floating point and paired singles enabled.
+  PowerPC::PowerPCState& ppc_state = system.GetPPCState();
+  ppc_state.msr.Hex = 0;
+  ppc_state.msr.FP = 1;
+  HID2(ppc_state).PSE = 1;
+  system.GetPowerPC().MSRUpdated();
+  ppc_state.gpr[7] = DATA_ADDRESS;
+
+  Interpreter& interpreter = system.GetInterpreter();
+  Common::ScopeGuard enable_cache_guard(
+      [&interpreter] { interpreter.SetDecodeCacheEnabled(true); });
+
+  interpreter.SetDecodeCacheEnabled(false);
+  const double uncached = MeasureStepsPerSecond(interpreter, ppc_state);
+  interpreter.SetDecodeCacheEnabled(true);
+  const double cached = MeasureStepsPerSecond(interpreter, ppc_state);
+
+  fmt::print("{} steps of a {} instruction loop\n", STEPS, code.size() / sizeof(u32));
+  fmt::print("  Decoding every step: {:.1f} M steps/s\n", uncached / 1e6);
+  fmt::print("  Decode cache:        {:.1f} M steps/s ({:.2f}x)\n", cached / 1e6,
+             cached / uncached);
+}
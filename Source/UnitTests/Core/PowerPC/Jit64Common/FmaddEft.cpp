@@ -0,0 +1,279 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/FloatUtils.h"
+#include "Common/ScopeGuard.h"
+#include "Common/x64ABI.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/Jit64/Jit.h"
+#include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PPCTables.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+#include "../TestValues.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr u32 FD = 1;
+constexpr u32 FA = 2;
+constexpr u32 FB = 3;
+constexpr u32 FC = 4;
+
+struct TestInstruction
+{
+  std::string_view name;
+  u32 opcd;
+  u32 subop5;
+  bool subtract;
+};
+
+constexpr std::array MADD_INSTRUCTIONS{
+    TestInstruction{"fmadds", 59, 29, false},   TestInstruction{"fmsubs", 59, 28, true},
+    TestInstruction{"ps_madd", 4, 29, false},   TestInstruction{"ps_msub", 4, 28, true},
+    TestInstruction{"ps_madds0", 4, 14, false}, TestInstruction{"ps_madds1", 4, 15, false},
+};
+
+constexpr std::array PAIRED_INSTRUCTIONS{
+    TestInstruction{"ps_muls0", 4, 12, false},
+    TestInstruction{"ps_muls1", 4, 13, false},
+    TestInstruction{"ps_sum0", 4, 10, false},
+    TestInstruction{"ps_sum1", 4, 11, false},
+};
+
+UGeckoInstruction EncodeInstruction(const TestInstruction& instruction)
+{
+  UGeckoInstruction inst;
+  inst.OPCD = instruction.opcd;
+  inst.SUBOP5 = instruction.subop5;
+  inst.FD = FD;
+  inst.FA = FA;
+  inst.FB = FB;
+  inst.FC = FC;
+  return inst;
+}
+
+// Compiles single instructions with the same instruction handlers that compile blocks, using the
+// default JIT settings, which include accurate fmadds.
+class TestJit64 : public Jit64
+{
+public:
+  explicit TestJit64(Core::System& system) : Jit64(system), m_memory(system.GetMemory())
+  {
+    m_memory.Init();
+    Init();
+  }
+
+  ~TestJit64() override
+  {
+    Shutdown();
+    m_memory.Shutdown();
+  }
+
+  using CompiledInstruction = void (*)();
+
+  // Returns a function that runs the instruction on the registers in PowerPCState, as if it were
+  // the only instruction of a block.
+  CompiledInstruction CompileSingleInstruction(UGeckoInstruction inst)
+  {
+    using namespace Gen;
+
+    PPCAnalyst::CodeOp op;
+    op.inst = inst;
+    op.opinfo = PPCTables::GetOpInfo(inst, 0);
+    op.fregOut = static_cast<s8>(inst.FD);
+    js.op = &op;
+    js.compilerPC = 0;
+    js.instructionsLeft = 0;
+
+    const auto function = reinterpret_cast<CompiledInstruction>(AlignCode16());
+    ABI_PushRegistersAndAdjustStack(ABI_ALL_CALLEE_SAVED, 8, 16);
+    MOV(64, R(RPPCSTATE), Imm64(reinterpret_cast<u64>(&m_ppc_state) + 0x80));
+
+    gpr.Start();
+    fpr.Start();
+    CompileInstruction(op);
+    gpr.Flush();
+    fpr.Flush();
+
+    ABI_PopRegistersAndAdjustStack(ABI_ALL_CALLEE_SAVED, 8, 16);
+    RET();
+
+    js.op = nullptr;
+    return function;
+  }
+
+private:
+  Memory::MemoryManager& m_memory;
+};
+
+double RandomSingle(std::mt19937_64& rng)
+{
+  const u32 sign = rng() & 0x80000000;
+  const u32 exponent = 127 - 20 + rng() % 41;
+  const u32 mantissa = rng() & 0x7fffff;
+  return std::bit_cast<float>(sign | exponent << 23 | mantissa);
+}
+
+double RandomDouble(std::mt19937_64& rng)
+{
+  const u64 sign = rng() & Common::DOUBLE_SIGN;
+  const u64 exponent = 1023 - 20 + rng() % 41;
+  const u64 mantissa = rng() & Common::DOUBLE_FRAC;
+  return std::bit_cast<double>(sign | exponent << 52 | mantissa);
+}
+
+// Random inputs almost never round to a tie, which is the only case the error-free transformation
+// changes anything for. This picks b so that a * c + b lands right on a tie, with a rounding error
+// of either sign or none at all.
+std::array<double, 3> RandomTieInputs(std::mt19937_64& rng, bool subtract)
+{
+  const double a = RandomSingle(rng);
+  const double c = RandomSingle(rng);
+
+  // The product of two singles is exact in double precision, and so is the difference of two
+  // doubles within a factor of two of each other.
+  const double product = a * c;
+  const u64 tie_bits = (std::bit_cast<u64>(product) & ~u64(0x1fffffff)) | 0x10000000;
+  double b = std::bit_cast<double>(tie_bits) - product;
+  switch (rng() % 3)
+  {
+  case 0:
+    b = std::nextafter(b, -std::numeric_limits<double>::infinity());
+    break;
+  case 1:
+    b = std::nextafter(b, std::numeric_limits<double>::infinity());
+    break;
+  }
+
+  return {a, c, subtract ? -b : b};
+}
+
+PowerPC::PairedSingle Run(const std::function<void()>& function, const std::array<double, 2>& a,
+                          const std::array<double, 2>& c, const std::array<double, 2>& b)
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  ppc_state.fpscr.Hex = 0;
+  ppc_state.ps[FD].SetBoth(u64(0), u64(0));
+  ppc_state.ps[FA].SetBoth(a[0], a[1]);
+  ppc_state.ps[FB].SetBoth(b[0], b[1]);
+  ppc_state.ps[FC].SetBoth(c[0], c[1]);
+  function();
+  return ppc_state.ps[FD];
+}
+
+void CheckInstruction(const TestInstruction& instruction, TestJit64::CompiledInstruction compiled,
+                      const std::array<double, 2>& a, const std::array<double, 2>& c,
+                      const std::array<double, 2>& b)
+{
+  // Unlike the interpreter, Force25BitPrecision doesn't normalize subnormals before rounding them,
+  // which isn't what this test is about.
+  if (std::fpclassify(c[0]) == FP_SUBNORMAL || std::fpclassify(c[1]) == FP_SUBNORMAL)
+    return;
+
+  auto& interpreter = Core::System::GetInstance().GetInterpreter();
+  const UGeckoInstruction inst = EncodeInstruction(instruction);
+  const PowerPC::PairedSingle expected =
+      Run([&] { Interpreter::RunInterpreterOp(interpreter, inst); }, a, c, b);
+
+  // NaNs are handled by separate code in the JIT, which is only used with accurate NaNs.
+  if (std::isnan(expected.PS0AsDouble()) || std::isnan(expected.PS1AsDouble()))
+    return;
+
+  const PowerPC::PairedSingle actual = Run(compiled, a, c, b);
+
+  EXPECT_EQ(expected.ps0, actual.ps0)
+      << fmt::format("{} a={} c={} b={}", instruction.name, a[0], c[0], b[0]);
+  EXPECT_EQ(expected.ps1, actual.ps1)
+      << fmt::format("{} a={} c={} b={}", instruction.name, a[1], c[1], b[1]);
+}
+
+void TestInstructionOnTestValues(const TestInstruction& instruction,
+                                 TestJit64::CompiledInstruction compiled)
+{
+  for (const u64 a : double_test_values)
+  {
+    for (const u64 c : double_test_values)
+    {
+      const std::array<double, 2> a_array{std::bit_cast<double>(a), 1.0};
+      const std::array<double, 2> c_array{std::bit_cast<double>(c), std::bit_cast<double>(c)};
+      for (const u64 b : double_test_values)
+      {
+        const std::array<double, 2> b_array{std::bit_cast<double>(b), std::bit_cast<double>(b)};
+        CheckInstruction(instruction, compiled, a_array, c_array, b_array);
+      }
+    }
+  }
+}
+
+void TestInstructionOnRandomValues(const TestInstruction& instruction,
+                                   TestJit64::CompiledInstruction compiled, bool ties)
+{
+  std::mt19937_64 rng(instruction.subop5 * 1234 + instruction.opcd);
+  for (int i = 0; i < 100000; ++i)
+  {
+    const std::array<double, 2> a{RandomDouble(rng), RandomSingle(rng)};
+    const std::array<double, 2> c{RandomDouble(rng), RandomSingle(rng)};
+    const std::array<double, 2> b{RandomDouble(rng), RandomSingle(rng)};
+    CheckInstruction(instruction, compiled, a, c, b);
+
+    if (ties)
+    {
+      const auto [a0, c0, b0] = RandomTieInputs(rng, instruction.subtract);
+      const auto [a1, c1, b1] = RandomTieInputs(rng, instruction.subtract);
+      CheckInstruction(instruction, compiled, {a0, a1}, {c0, c1}, {b0, b1});
+    }
+  }
+}
+}  // namespace
+
+TEST(Jit64, FmaddErrorFreeTransformation)
+{
+  if (!cpu_info.bFMA)
+    GTEST_SKIP() << "The host CPU doesn't support FMA instructions";
+
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  TestJit64 jit(Core::System::GetInstance());
+
+  for (const TestInstruction& instruction : MADD_INSTRUCTIONS)
+  {
+    const auto compiled = jit.CompileSingleInstruction(EncodeInstruction(instruction));
+    TestInstructionOnTestValues(instruction, compiled);
+    TestInstructionOnRandomValues(instruction, compiled, true);
+  }
+}
+
+TEST(Jit64, PairedSingleMultiplyAndSum)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  TestJit64 jit(Core::System::GetInstance());
+
+  for (const TestInstruction& instruction : PAIRED_INSTRUCTIONS)
+  {
+    const auto compiled = jit.CompileSingleInstruction(EncodeInstruction(instruction));
+    TestInstructionOnTestValues(instruction, compiled);
+    TestInstructionOnRandomValues(instruction, compiled, false);
+  }
+}
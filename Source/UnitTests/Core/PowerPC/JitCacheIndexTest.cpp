@@ -0,0 +1,132 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <initializer_list>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/PowerPC/JitCommon/JitCache.h"
+
+namespace
+{
+JitBlock MakeBlock(std::initializer_list<u32> physical_addresses,
+                   std::initializer_list<u32> exit_addresses = {})
+{
+  JitBlock block(false);
+  block.physical_addresses = physical_addresses;
+  for (u32 exit_address : exit_addresses)
+  {
+    JitBlock::LinkData link_data{};
+    link_data.exitAddress = exit_address;
+    block.linkData.push_back(link_data);
+  }
+  return block;
+}
+
+std::set<const JitBlock*> GetBlocksInPage(JitPageIndex& index, u32 page)
+{
+  std::set<const JitBlock*> blocks;
+  index.ForEachBlock(page, [&](JitBlock& block) { blocks.insert(&block); });
+  return blocks;
+}
+
+std::vector<const JitBlock*> GetExitSources(JitExitIndex& index, u32 address)
+{
+  std::vector<const JitBlock*> sources;
+  index.ForEachExitTo(address, [&](JitBlock::LinkData& e) { sources.push_back(e.source); });
+  return sources;
+}
+}  // namespace
+
+TEST(JitPageIndex, AddAndRemove)
+{
+  JitPageIndex index;
+
+  JitBlock a = MakeBlock({0x80001000, 0x80001004});
+  // Spans two pages.
+  JitBlock b = MakeBlock({0x80001ffc, 0x80002000, 0x80002004});
+
+  index.AddBlock(a);
+  index.AddBlock(b);
+  EXPECT_EQ(a.page_links.size(), 1u);
+  EXPECT_EQ(b.page_links.size(), 2u);
+
+  EXPECT_FALSE(index.HasCode(0x80000));
+  EXPECT_TRUE(index.HasCode(0x80001));
+  EXPECT_TRUE(index.HasCode(0x80002));
+  EXPECT_EQ(GetBlocksInPage(index, 0x80001), (std::set<const JitBlock*>{&a, &b}));
+  EXPECT_EQ(GetBlocksInPage(index, 0x80002), (std::set<const JitBlock*>{&b}));
+
+  index.RemoveBlock(b);
+  EXPECT_TRUE(b.page_links.empty());
+  EXPECT_EQ(GetBlocksInPage(index, 0x80001), (std::set<const JitBlock*>{&a}));
+  EXPECT_FALSE(index.HasCode(0x80002));
+
+  index.RemoveBlock(a);
+  EXPECT_FALSE(index.HasCode(0x80001));
+}
+
+TEST(JitPageIndex, RemoveWhileIterating)
+{
+  JitPageIndex index;
+
+  std::vector<JitBlock> blocks;
+  blocks.reserve(8);
+  for (u32 i = 0; i < 8; ++i)
+    blocks.push_back(MakeBlock({0x1000 + i * 4, 0x2000 + i * 4}));
+  for (JitBlock& block : blocks)
+    index.AddBlock(block);
+
+  int visited = 0;
+  index.ForEachBlock(1, [&](JitBlock& block) {
+    ++visited;
+    index.RemoveBlock(block);
+  });
+
+  EXPECT_EQ(visited, 8);
+  EXPECT_FALSE(index.HasCode(1));
+  EXPECT_FALSE(index.HasCode(2));
+}
+
+TEST(JitPageIndex, Clear)
+{
+  JitPageIndex index;
+
+  JitBlock a = MakeBlock({0xfffff000});
+  index.AddBlock(a);
+  EXPECT_TRUE(index.HasCode(0xfffff));
+
+  index.Clear();
+  EXPECT_FALSE(index.HasCode(0xfffff));
+  EXPECT_TRUE(GetBlocksInPage(index, 0xfffff).empty());
+}
+
+TEST(JitExitIndex, AddAndRemove)
+{
+  JitExitIndex index;
+
+  // 0x80000000 and 0x80040000 land in the same bucket.
+  JitBlock a = MakeBlock({0x1000}, {0x80000000, 0x80040000});
+  JitBlock b = MakeBlock({0x2000}, {0x80000000});
+  JitBlock unlinked = MakeBlock({0x3000}, {0x80000000});
+
+  index.AddBlock(a);
+  index.AddBlock(b);
+
+  EXPECT_EQ(GetExitSources(index, 0x80000000).size(), 2u);
+  EXPECT_EQ(GetExitSources(index, 0x80040000), (std::vector<const JitBlock*>{&a}));
+  EXPECT_TRUE(GetExitSources(index, 0x80000004).empty());
+
+  index.RemoveBlock(a);
+  EXPECT_EQ(GetExitSources(index, 0x80000000), (std::vector<const JitBlock*>{&b}));
+  EXPECT_TRUE(GetExitSources(index, 0x80040000).empty());
+
+  // Removing a block that was never added is harmless.
+  index.RemoveBlock(unlinked);
+  EXPECT_EQ(GetExitSources(index, 0x80000000), (std::vector<const JitBlock*>{&b}));
+
+  index.Clear();
+  EXPECT_TRUE(GetExitSources(index, 0x80000000).empty());
+}
@@ -0,0 +1,106 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/BitSet.h"
+#include "Core/PowerPC/JitCommon/LinearScanAllocator.h"
+
+using JitCommon::LinearScanAllocator;
+
+namespace
+{
+// Fills in regs_in_use the way PPCAnalyst does for a block consisting of the given instructions.
+std::vector<LinearScanAllocator::RegUsage>
+MakeBlock(std::vector<LinearScanAllocator::RegUsage> usages)
+{
+  BitSet32 in_use;
+  for (auto it = usages.rbegin(); it != usages.rend(); ++it)
+  {
+    it->regs_in_use = in_use;
+    in_use |= it->regs_in | it->regs_out;
+  }
+  return usages;
+}
+}  // namespace
+
+TEST(LinearScanAllocator, AssignsDistinctSlots)
+{
+  const auto block = MakeBlock({
+      {BitSet32{1, 2}, BitSet32{3}, {}},
+      {BitSet32{3, 1}, BitSet32{4}, {}},
+      {BitSet32{4, 2}, BitSet32{}, {}},
+  });
+
+  LinearScanAllocator allocator;
+  allocator.Allocate(block, 8);
+
+  EXPECT_EQ(allocator.GetLiveRangeCount(), 4u);
+  EXPECT_EQ(allocator.GetSpilledLiveRangeCount(), 0u);
+
+  const s8 slot_1 = allocator.GetSlot(1, 1);
+  const s8 slot_2 = allocator.GetSlot(2, 1);
+  const s8 slot_3 = allocator.GetSlot(3, 1);
+  EXPECT_NE(slot_1, LinearScanAllocator::NO_SLOT);
+  EXPECT_NE(slot_1, slot_2);
+  EXPECT_NE(slot_1, slot_3);
+  EXPECT_NE(slot_2, slot_3);
+
+  // Both reads of r2 see the same slot, and r1 isn't live anymore after its last read.
+  EXPECT_EQ(allocator.GetSlot(2, 0), allocator.GetSlot(2, 2));
+  EXPECT_EQ(allocator.GetSlot(1, 2), LinearScanAllocator::NO_SLOT);
+}
+
+TEST(LinearScanAllocator, ReusesSlotsOfEndedRanges)
+{
+  const auto block = MakeBlock({
+      {BitSet32{0}, BitSet32{}, {}},
+      {BitSet32{0}, BitSet32{}, {}},
+      {BitSet32{1}, BitSet32{}, {}},
+      {BitSet32{1}, BitSet32{}, {}},
+  });
+
+  LinearScanAllocator allocator;
+  allocator.Allocate(block, 1);
+
+  EXPECT_EQ(allocator.GetSpilledLiveRangeCount(), 0u);
+  EXPECT_EQ(allocator.GetSlot(0, 1), 0);
+  EXPECT_EQ(allocator.GetSlot(1, 2), 0);
+}
+
+TEST(LinearScanAllocator, SpillsRangeThatEndsLast)
+{
+  const auto block = MakeBlock({
+      {BitSet32{0}, BitSet32{}, {}},
+      {BitSet32{1}, BitSet32{}, {}},
+      {BitSet32{2}, BitSet32{}, {}},
+      {BitSet32{1, 2}, BitSet32{}, {}},
+      {BitSet32{0}, BitSet32{}, {}},
+  });
+
+  LinearScanAllocator allocator;
+  allocator.Allocate(block, 2);
+
+  EXPECT_EQ(allocator.GetSpilledLiveRangeCount(), 1u);
+  EXPECT_EQ(allocator.GetSlot(0, 0), LinearScanAllocator::NO_SLOT);
+  EXPECT_EQ(allocator.GetSlot(0, 4), LinearScanAllocator::NO_SLOT);
+  EXPECT_NE(allocator.GetSlot(1, 3), LinearScanAllocator::NO_SLOT);
+  EXPECT_NE(allocator.GetSlot(2, 3), LinearScanAllocator::NO_SLOT);
+  EXPECT_NE(allocator.GetSlot(1, 3), allocator.GetSlot(2, 3));
+}
+
+TEST(LinearScanAllocator, OverwriteStartsNewRange)
+{
+  const auto block = MakeBlock({
+      {BitSet32{3}, BitSet32{}, {}},
+      {BitSet32{}, BitSet32{3}, {}},
+      {BitSet32{3}, BitSet32{}, {}},
+  });
+
+  LinearScanAllocator allocator;
+  allocator.Allocate(block, 4);
+
+  EXPECT_EQ(allocator.GetLiveRangeCount(), 2u);
+}
@@ -0,0 +1,224 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/HostDisassembler.h"
+#include "Common/ScopeGuard.h"
+#include "Common/StringUtil.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/Jit64/Jit.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr size_t BLOCK_COUNT = 500;
+// Translation is off, so this is a physical address in MEM1.
+constexpr u32 CODE_ADDRESS = 0x00010000;
+
+// Code resembling the blocks of some kind of game code.
+struct BlockShape
+{
+  std::string_view name;
+  bool paired_single;
+  size_t min_length;
+  size_t max_length;
+  // How many different guest registers the blocks use.
+  int working_set;
+};
+
+constexpr std::array BLOCK_SHAPES{
+    BlockShape{"Integer", false, 20, 120, 20},
+    BlockShape{"Paired single", true, 30, 200, 26},
+};
+
+// Generates a block of integer or paired single arithmetic that ends in a blr.
+std::vector<UGeckoInstruction> GenerateBlock(const BlockShape& shape, std::mt19937& rng)
+{
+  std::vector<u32> regs(32);
+  for (u32 i = 0; i < 32; ++i)
+    regs[i] = i;
+  std::ranges::shuffle(regs, rng);
+  regs.resize(shape.working_set);
+
+  // Code tends to work on a few registers at a time, so pick registers close to the ones picked
+  // recently more often than the rest.
+  std::geometric_distribution<int> distance(0.3);
+  std::uniform_int_distribution<size_t> length(shape.min_length, shape.max_length);
+  int position = 0;
+  const auto pick_reg = [&] {
+    const int offset = distance(rng) * (rng() % 2 ? 1 : -1);
+    position = (position + offset + shape.working_set * 8) % shape.working_set;
+    return regs[position];
+  };
+
+  std::vector<UGeckoInstruction> block(length(rng), UGeckoInstruction{0});
+  for (UGeckoInstruction& inst : block)
+  {
+    if (shape.paired_single)
+    {
+      // ps_add, ps_sub, ps_mul and ps_madd
+      constexpr std::array<u32, 4> SUBOP5{21, 20, 25, 29};
+      inst.OPCD = 4;
+      inst.SUBOP5 = SUBOP5[rng() % SUBOP5.size()];
+      inst.FA = pick_reg();
+      if (inst.SUBOP5 != 25)
+        inst.FB = pick_reg();
+      if (inst.SUBOP5 == 25 || inst.SUBOP5 == 29)
+        inst.FC = pick_reg();
+      inst.FD = pick_reg();
+    }
+    else
+    {
+      // add, subf and mullw
+      constexpr std::array<u32, 3> SUBOP10{266, 40, 235};
+      inst.OPCD = 31;
+      inst.SUBOP10 = SUBOP10[rng() % SUBOP10.size()];
+      inst.RA = pick_reg();
+      inst.RB = pick_reg();
+      inst.RD = pick_reg();
+    }
+  }
+  block.push_back(UGeckoInstruction{0x4e800020});  // blr
+
+  return block;
+}
+
+// Compiles blocks with the same code that compiles the blocks of games, and counts the moves
+// between the register caches and ppcState in the generated code.
+class TestJit64 : public Jit64
+{
+public:
+  explicit TestJit64(Core::System& system) : Jit64(system), m_memory(system.GetMemory())
+  {
+    m_memory.Init();
+    Init();
+  }
+
+  ~TestJit64() override
+  {
+    Shutdown();
+    m_memory.Shutdown();
+  }
+
+  void SetLinearScanRegisterAllocation(bool enable)
+  {
+    m_enable_linear_scan_register_allocation = enable;
+    ClearCache();
+  }
+
+  // Returns the block that starts at address, compiling it first.
+  const JitBlock& Compile(u32 address)
+  {
+    Jit(address);
+    return *blocks.GetBlockFromStartAddress(address, m_ppc_state.feature_flags);
+  }
+
+  // Counts the instructions that move data from or to ppcState, which RPPCSTATE (RBP) points into.
+  size_t CountPPCStateMoves(const JitBlock& block) const
+  {
+    std::ostringstream stream;
+    m_disassembler->Disassemble(block.normalEntry, block.near_end, stream);
+    m_disassembler->Disassemble(block.far_begin, block.far_end, stream);
+
+    size_t count = 0;
+    std::istringstream lines(stream.str());
+    std::string line;
+    while (std::getline(lines, line))
+    {
+      // Each line is an address and an instruction, separated by a tab.
+      std::string instruction(
+          StripWhitespace(std::string_view(line).substr(line.find('\t') + 1)));
+      Common::ToLower(&instruction);
+      if (instruction.starts_with("mov") && instruction.contains("rbp"))
+        ++count;
+    }
+    return count;
+  }
+
+private:
+  Memory::MemoryManager& m_memory;
+};
+
+struct Result
+{
+  size_t ppc_state_moves = 0;
+  std::chrono::duration<double> compile_time{};
+};
+
+Result CompileBlocks(TestJit64& jit, const std::vector<u32>& addresses)
+{
+  Result result;
+  for (const u32 address : addresses)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    const JitBlock& block = jit.Compile(address);
+    result.compile_time += std::chrono::steady_clock::now() - start;
+    result.ppc_state_moves += jit.CountPPCStateMoves(block);
+  }
+  return result;
+}
+}  // namespace
+
+TEST(LinearScanBenchmark, PPCStateMoves)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  Core::System& system = Core::System::GetInstance();
+  TestJit64 jit(system);
+
+  // Run without address translation and with floating point enabled, so that the blocks are
+  // compiled without any exception checks.
+  PowerPC::PowerPCState& ppc_state = system.GetPPCState();
+  ppc_state.msr.Hex = 0;
+  ppc_state.msr.FP = 1;
+  system.GetPowerPC().MSRUpdated();
+
+  auto& memory = system.GetMemory();
+  std::mt19937 rng(0x5eed);
+
+  for (const BlockShape& shape : BLOCK_SHAPES)
+  {
+    std::vector<u32> addresses;
+    size_t instructions = 0;
+    u32 address = CODE_ADDRESS;
+    for (size_t i = 0; i < BLOCK_COUNT; ++i)
+    {
+      addresses.push_back(address);
+      for (const UGeckoInstruction inst : GenerateBlock(shape, rng))
+      {
+        memory.Write_U32(inst.hex, address);
+        address += sizeof(u32);
+        ++instructions;
+      }
+    }
+
+    jit.SetLinearScanRegisterAllocation(false);
+    const Result heuristic = CompileBlocks(jit, addresses);
+    jit.SetLinearScanRegisterAllocation(true);
+    const Result linear_scan = CompileBlocks(jit, addresses);
+
+    fmt::print("{}: {} blocks, {} instructions\n", shape.name, addresses.size(), instructions);
+    fmt::print("  Heuristic:   {} ppcState moves, {:.1f} ns per instruction to compile\n",
+               heuristic.ppc_state_moves, heuristic.compile_time.count() * 1e9 / instructions);
+    fmt::print("  Linear scan: {} ppcState moves, {:.1f} ns per instruction to compile\n",
+               linear_scan.ppc_state_moves, linear_scan.compile_time.count() * 1e9 / instructions);
+  }
+}
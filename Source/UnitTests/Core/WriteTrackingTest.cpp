@@ -0,0 +1,79 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <thread>
+
+#include "Common/CommonTypes.h"
+#include "Common/ScopeGuard.h"
+#include "Core/HW/Memmap.h"
+#include "Core/MemTools.h"
+#include "Core/System.h"
+
+// include order is important
+#include <gtest/gtest.h>  // NOLINT
+
+#ifdef _MSC_VER
+#define ASAN_DISABLE __declspec(no_sanitize_address)
+#else
+#define ASAN_DISABLE
+#endif
+
+static void ASAN_DISABLE WriteByte(u8* data)
+{
+  *(volatile u8*)data = 5;
+}
+
+TEST(WriteTracking, WriteTracking)
+{
+  if (!EMM::IsExceptionHandlerSupported() || !EMM::IsExceptionHandlerProcessWide())
+    GTEST_SKIP() << "Skipping WriteTracking test because exception handler is unsupported.";
+
+  EMM::InstallExceptionHandler();
+  auto& memory = Core::System::GetInstance().GetMemory();
+  memory.Init();
+  memory.SetWriteTrackingActive(true);
+  Common::ScopeGuard guard([&memory] {
+    memory.SetWriteTrackingActive(false);
+    memory.Shutdown();
+    EMM::UninstallExceptionHandler();
+  });
+  if (!memory.IsWriteTrackingActive())
+    GTEST_SKIP() << "Skipping WriteTracking test because write tracking is unsupported.";
+
+  constexpr u32 address = 0x00100000;
+  constexpr u32 size = 0x10000;
+  u8* const ram = memory.GetRAM();
+
+  u64 stamp = memory.TrackWrites(address, size);
+  ASSERT_NE(stamp, 0u);
+  EXPECT_FALSE(memory.WasWrittenSince(address, size, stamp));
+
+  // Writes outside of the range don't count.
+  WriteByte(ram + address + size * 2);
+  EXPECT_FALSE(memory.WasWrittenSince(address, size, stamp));
+
+  WriteByte(ram + address + size / 2);
+  EXPECT_TRUE(memory.WasWrittenSince(address, size, stamp));
+  EXPECT_EQ(ram[address + size / 2], 5);
+
+  // Once a range is tracked again, earlier writes don't count anymore.
+  stamp = memory.TrackWrites(address, size);
+  EXPECT_FALSE(memory.WasWrittenSince(address, size, stamp));
+
+  // Writes through other addresses of the same memory count.
+  memory.Write_U32(0x12345678, 0x80000000 | (address + size - 4));
+  EXPECT_TRUE(memory.WasWrittenSince(address, size, stamp));
+  EXPECT_EQ(memory.Read_U32(address + size - 4), 0x12345678u);
+
+  // So do writes from other threads.
+  stamp = memory.TrackWrites(address, size);
+  std::thread([ram] { WriteByte(ram + address); }).join();
+  EXPECT_TRUE(memory.WasWrittenSince(address, size, stamp));
+
+  // Deactivating tracking counts everything as written.
+  stamp = memory.TrackWrites(address, size);
+  memory.SetWriteTrackingActive(false);
+  EXPECT_TRUE(memory.WasWrittenSince(address, size, stamp));
+  EXPECT_EQ(memory.TrackWrites(address, size), 0u);
+  WriteByte(ram + address);
+}
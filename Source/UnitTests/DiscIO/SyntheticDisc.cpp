@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "SyntheticDisc.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+#include "Common/IOFile.h"
+#include "Common/Swap.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/DiscUtils.h"
+#include "DiscIO/WIABlob.h"
+
+namespace SyntheticDisc
+{
+std::vector<u8> Generate(u64 size)
+{
+  constexpr u64 BLOCK_SIZE = 0x10000;
+
+  std::vector<u8> data(size);
+  std::mt19937 rng(0x5eed);
+
+  for (u64 offset = 0; offset < size; offset += BLOCK_SIZE)
+  {
+    u8* const block = data.data() + offset;
+    const u64 block_size = std::min(BLOCK_SIZE, size - offset);
+    switch ((offset / BLOCK_SIZE) % 3)
+    {
+    case 0:
+      std::generate_n(block, block_size, [&rng] { return static_cast<u8>(rng()); });
+      break;
+    case 1:
+      for (u64 i = 0; i < block_size; ++i)
+        block[i] = static_cast<u8>(i * 7 + offset / BLOCK_SIZE);
+      break;
+    default:
+      break;
+    }
+  }
+
+  const char game_id[] = "DTST01";
+  std::memcpy(data.data(), game_id, sizeof(game_id) - 1);
+  const u32 magic = Common::swap32(DiscIO::GAMECUBE_DISC_MAGIC);
+  std::memcpy(data.data() + 0x1C, &magic, sizeof(magic));
+
+  return data;
+}
+
+std::string WriteRVZ(const std::string& directory, const std::vector<u8>& data,
+                     DiscIO::WIARVZCompressionType compression_type, int chunk_size)
+{
+  const std::string iso_path = directory + "/synthetic.iso";
+  const std::string rvz_path = directory + "/synthetic.rvz";
+
+  {
+    File::IOFile iso(iso_path, "wb");
+    if (!iso.WriteBytes(data.data(), data.size()))
+      return {};
+  }
+
+  const std::unique_ptr<DiscIO::BlobReader> reader = DiscIO::CreateBlobReader(iso_path);
+  if (!reader)
+    return {};
+
+  const auto [min_level, max_level] = DiscIO::GetAllowedCompressionLevels(compression_type, false);
+  const int level = std::clamp(5, min_level, std::max(min_level, max_level));
+  if (!DiscIO::ConvertToWIAOrRVZ(reader.get(), iso_path, rvz_path, true, compression_type, level,
+                                 chunk_size, [](const std::string&, float) { return true; }))
+  {
+    return {};
+  }
+
+  return rvz_path;
+}
+}  // namespace SyntheticDisc
@@ -0,0 +1,26 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace DiscIO
+{
+enum class WIARVZCompressionType : u32;
+}
+
+namespace SyntheticDisc
+{
+// Returns the contents of a GameCube disc image of the given size that has a valid disc header and
+// a deterministic mix of incompressible, repetitive and zeroed data.
+std::vector<u8> Generate(u64 size);
+
+// Writes data to directory as a plain image, converts it to RVZ, and returns the path of the RVZ
+// file. Returns an empty string on failure.
+std::string WriteRVZ(const std::string& directory, const std::vector<u8>& data,
+                     DiscIO::WIARVZCompressionType compression_type, int chunk_size);
+}  // namespace SyntheticDisc
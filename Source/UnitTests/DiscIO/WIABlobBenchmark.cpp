@@ -0,0 +1,85 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/WIABlob.h"
+
+#include "SyntheticDisc.h"
+
+namespace
+{
+constexpr u64 DISC_SIZE = 0x10000000;
+constexpr u64 READ_SIZE = 0x8000;
+constexpr int CHUNK_SIZE = 0x20000;
+
+struct BenchmarkResult
+{
+  double sequential_mib_per_second;
+  double random_mib_per_second;
+};
+
+double MeasureMiBPerSecond(DiscIO::BlobReader& reader, const std::vector<u64>& offsets)
+{
+  std::vector<u8> buffer(READ_SIZE);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (const u64 offset : offsets)
+    EXPECT_TRUE(reader.Read(offset, READ_SIZE, buffer.data()));
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  return offsets.size() * READ_SIZE / (1024.0 * 1024.0) / elapsed.count();
+}
+
+BenchmarkResult RunBenchmark(DiscIO::WIARVZCompressionType compression_type)
+{
+  const std::string directory = File::CreateTempDir();
+  const std::string path = SyntheticDisc::WriteRVZ(
+      directory, SyntheticDisc::Generate(DISC_SIZE), compression_type, CHUNK_SIZE);
+  EXPECT_FALSE(path.empty());
+
+  BenchmarkResult result{};
+  if (std::unique_ptr<DiscIO::BlobReader> reader = DiscIO::CreateBlobReader(path))
+  {
+    std::vector<u64> offsets;
+    for (u64 offset = 0; offset < DISC_SIZE; offset += READ_SIZE)
+      offsets.push_back(offset);
+    result.sequential_mib_per_second = MeasureMiBPerSecond(*reader, offsets);
+
+    std::mt19937 rng(1234);
+    std::shuffle(offsets.begin(), offsets.end(), rng);
+    offsets.resize(offsets.size() / 4);
+    result.random_mib_per_second = MeasureMiBPerSecond(*reader, offsets);
+  }
+
+  File::DeleteDirRecursively(directory);
+  return result;
+}
+}  // namespace
+
+TEST(WIABlobBenchmark, ReadThroughput)
+{
+  using Type = DiscIO::WIARVZCompressionType;
+  constexpr std::array<std::pair<Type, const char*>, 3> COMPRESSION_TYPES{
+      {{Type::Zstd, "Zstandard"}, {Type::LZMA2, "LZMA2"}, {Type::Bzip2, "bzip2"}}};
+
+  for (const auto& [type, name] : COMPRESSION_TYPES)
+  {
+    const BenchmarkResult result = RunBenchmark(type);
+    fmt::print("RVZ {:>9}: sequential {:8.1f} MiB/s, random {:8.1f} MiB/s\n", name,
+               result.sequential_mib_per_second, result.random_mib_per_second);
+  }
+}
@@ -0,0 +1,95 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/WIABlob.h"
+
+#include "SyntheticDisc.h"
+
+class WIABlobTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_directory = File::CreateTempDir();
+    ASSERT_FALSE(m_directory.empty());
+
+    m_data = SyntheticDisc::Generate(DISC_SIZE);
+    const std::string path = SyntheticDisc::WriteRVZ(
+        m_directory, m_data, DiscIO::WIARVZCompressionType::Zstd, CHUNK_SIZE);
+    ASSERT_FALSE(path.empty());
+
+    m_reader = DiscIO::CreateBlobReader(path);
+    ASSERT_NE(m_reader, nullptr);
+  }
+
+  void TearDown() override
+  {
+    m_reader.reset();
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void ExpectRead(u64 offset, u64 size)
+  {
+    std::vector<u8> buffer(size);
+    ASSERT_TRUE(m_reader->Read(offset, size, buffer.data()));
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), m_data.begin() + offset))
+        << "offset " << offset << ", size " << size;
+  }
+
+  static constexpr u64 DISC_SIZE = 0x800000;
+  static constexpr int CHUNK_SIZE = 0x20000;
+
+  std::string m_directory;
+  std::vector<u8> m_data;
+  std::unique_ptr<DiscIO::BlobReader> m_reader;
+};
+
+TEST_F(WIABlobTest, SequentialReads)
+{
+  // Sequential reads make the reader decompress upcoming groups on other threads.
+  for (u64 offset = 0; offset < DISC_SIZE; offset += 0x8000)
+    ExpectRead(offset, 0x8000);
+}
+
+TEST_F(WIABlobTest, ReadsSpanningGroups)
+{
+  for (u64 offset = CHUNK_SIZE - 0x100; offset + CHUNK_SIZE < DISC_SIZE; offset += CHUNK_SIZE)
+    ExpectRead(offset, 0x200);
+
+  ExpectRead(0, DISC_SIZE);
+}
+
+TEST_F(WIABlobTest, RandomReads)
+{
+  std::mt19937 rng(1234);
+  for (int i = 0; i < 200; ++i)
+  {
+    const u64 size = rng() % 0x10000 + 1;
+    const u64 offset = rng() % (DISC_SIZE - size);
+    ExpectRead(offset, size);
+  }
+}
+
+TEST_F(WIABlobTest, CopiedReader)
+{
+  ExpectRead(0x10000, 0x40000);
+
+  const std::unique_ptr<DiscIO::BlobReader> copy = m_reader->CopyReader();
+  ASSERT_NE(copy, nullptr);
+
+  std::vector<u8> buffer(0x40000);
+  ASSERT_TRUE(copy->Read(0x50000, buffer.size(), buffer.data()));
+  EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), m_data.begin() + 0x50000));
+}
@@ -0,0 +1,181 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/ColorMath.h"
+
+namespace
+{
+using Color = std::array<u8, 4>;
+
+constexpr size_t PIXEL_COUNT = 1 << 16;
+constexpr int PASSES = 32;
+// Roughly what a game uses per pixel
+constexpr int TEV_STAGES = 3;
+
+struct Pixel
+{
+  std::array<Color, 4> texels;
+  std::array<s16, 4> weights;
+  ColorMath::Channels a, c, d;
+  Color dst;
+  u32 src_factor;
+  u32 dst_factor;
+};
+
+constexpr ColorMath::CombinerParams PARAMS{
+    .bias = 0,
+    .left_shift = 0,
+    .right_shift = 0,
+    .rounding = 128,
+    .subtract = false,
+    .min = 0,
+    .max = 255,
+};
+
+// The per-channel code the software renderer used before ColorMath existed.
+struct Scalar
+{
+  static ColorMath::Channels CombineRegular(const ColorMath::Channels& a,
+                                            const ColorMath::Channels& b,
+                                            const ColorMath::Channels& c,
+                                            const ColorMath::Channels& d,
+                                            const ColorMath::CombinerParams& params)
+  {
+    ColorMath::Channels result;
+    for (size_t i = 0; i < result.size(); i++)
+    {
+      const u16 extended_c = c[i] + (c[i] >> 7);
+      s32 temp = a[i] * (256 - extended_c) + (b[i] * extended_c);
+      temp <<= params.left_shift;
+      temp += params.rounding;
+      temp >>= 8;
+      temp = params.subtract ? -temp : temp;
+
+      s32 sum = ((d[i] + params.bias) << params.left_shift) + temp;
+      sum >>= params.right_shift;
+      result[i] = static_cast<s16>(std::clamp<s32>(sum, params.min, params.max));
+    }
+    return result;
+  }
+
+  static void Blend(const u8* src, const u8* dst, u32 src_factor, u32 dst_factor, u8* out)
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      u32 sf = (src_factor & 0xff);
+      sf += sf >> 7;
+      u32 df = (dst_factor & 0xff);
+      df += df >> 7;
+
+      const u32 color = (src[i] * sf + dst[i] * df) >> 8;
+      out[i] = (color > 255) ? 255 : color;
+
+      dst_factor >>= 8;
+      src_factor >>= 8;
+    }
+  }
+
+  static void Filter(const u8* t0, const u8* t1, const u8* t2, const u8* t3, s16 w0, s16 w1,
+                     s16 w2, s16 w3, u32 shift, u8* out)
+  {
+    for (int i = 0; i < 4; i++)
+      out[i] = static_cast<u8>((t0[i] * w0 + t1[i] * w1 + t2[i] * w2 + t3[i] * w3) >> shift);
+  }
+};
+
+struct Simd
+{
+  static constexpr auto CombineRegular = ColorMath::CombineRegular;
+  static constexpr auto Blend = ColorMath::Blend;
+  static constexpr auto Filter = ColorMath::Filter;
+};
+
+// Filters a texel, runs it through a few combiner stages and blends the result, which is most of
+// the arithmetic the software renderer does for a textured pixel. Returns a checksum so that none
+// of the work can be optimized away.
+template <typename Math>
+u32 ShadePixels(const std::vector<Pixel>& pixels)
+{
+  u32 checksum = 0;
+  for (const Pixel& pixel : pixels)
+  {
+    Color texel;
+    Math::Filter(pixel.texels[0].data(), pixel.texels[1].data(), pixel.texels[2].data(),
+                 pixel.texels[3].data(), pixel.weights[0], pixel.weights[1], pixel.weights[2],
+                 pixel.weights[3], 14, texel.data());
+
+    ColorMath::Channels color{texel[0], texel[1], texel[2], texel[3]};
+    for (int stage = 0; stage < TEV_STAGES; ++stage)
+      color = Math::CombineRegular(pixel.a, color, pixel.c, pixel.d, PARAMS);
+
+    const Color src{static_cast<u8>(color[0]), static_cast<u8>(color[1]),
+                    static_cast<u8>(color[2]), static_cast<u8>(color[3])};
+    Color out;
+    Math::Blend(src.data(), pixel.dst.data(), pixel.src_factor, pixel.dst_factor, out.data());
+    checksum = checksum * 31 + out[0] + out[1] + out[2] + out[3];
+  }
+  return checksum;
+}
+
+template <typename Math>
+double MeasurePixelsPerSecond(const std::vector<Pixel>& pixels, u32* checksum)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < PASSES; ++pass)
+    *checksum += ShadePixels<Math>(pixels);
+  const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+  return pixels.size() * PASSES / time.count();
+}
+}  // namespace
+
+TEST(ColorMathBenchmark, PixelsPerSecond)
+{
+  std::mt19937 rng(0x5eed);
+  std::uniform_int_distribution<int> channel(0, 255);
+  std::uniform_int_distribution<int> fract(0, 128);
+  std::uniform_int_distribution<u32> random_u32;
+
+  std::vector<Pixel> pixels(PIXEL_COUNT);
+  for (Pixel& pixel : pixels)
+  {
+    for (Color& texel : pixel.texels)
+    {
+      for (u8& value : texel)
+        value = static_cast<u8>(channel(rng));
+    }
+    const int fract_s = fract(rng);
+    const int fract_t = fract(rng);
+    pixel.weights = {s16((128 - fract_s) * (128 - fract_t)), s16(fract_s * (128 - fract_t)),
+                     s16((128 - fract_s) * fract_t), s16(fract_s * fract_t)};
+    for (size_t i = 0; i < 4; ++i)
+    {
+      pixel.a[i] = static_cast<s16>(channel(rng));
+      pixel.c[i] = static_cast<s16>(channel(rng));
+      pixel.d[i] = static_cast<s16>(channel(rng));
+      pixel.dst[i] = static_cast<u8>(channel(rng));
+    }
+    pixel.src_factor = random_u32(rng);
+    pixel.dst_factor = random_u32(rng);
+  }
+
+  u32 scalar_checksum = 0;
+  u32 simd_checksum = 0;
+  const double scalar = MeasurePixelsPerSecond<Scalar>(pixels, &scalar_checksum);
+  const double simd = MeasurePixelsPerSecond<Simd>(pixels, &simd_checksum);
+
+  EXPECT_EQ(scalar_checksum, simd_checksum);
+
+  fmt::print("{} pixels, {} TEV stages each\n", pixels.size() * PASSES, TEV_STAGES);
+  fmt::print("  Scalar:    {:.1f} Mpixels/s\n", scalar / 1e6);
+  fmt::print("  ColorMath: {:.1f} Mpixels/s ({:.2f}x)\n", simd / 1e6, simd / scalar);
+}
@@ -0,0 +1,171 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/ColorMath.h"
+
+namespace
+{
+// The per-channel formulas the software renderer used before ColorMath existed.
+s16 ReferenceCombine(s16 a, s16 b, s16 c, s16 d, const ColorMath::CombinerParams& params)
+{
+  const u16 extended_c = c + (c >> 7);
+
+  s32 temp = a * (256 - extended_c) + (b * extended_c);
+  temp <<= params.left_shift;
+  temp += params.rounding;
+  temp >>= 8;
+  temp = params.subtract ? -temp : temp;
+
+  s32 result = ((d + params.bias) << params.left_shift) + temp;
+  result = result >> params.right_shift;
+
+  return std::clamp<s16>(static_cast<s16>(result), params.min, params.max);
+}
+
+u8 ReferenceBlend(u8 src, u8 dst, u8 src_factor, u8 dst_factor)
+{
+  u32 sf = src_factor;
+  sf += sf >> 7;
+  u32 df = dst_factor;
+  df += df >> 7;
+
+  const u32 color = (src * sf + dst * df) >> 8;
+  return (color > 255) ? 255 : color;
+}
+}  // namespace
+
+TEST(ColorMath, CombineRegular)
+{
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> input(0, 255);
+  std::uniform_int_distribution<int> d_input(-1024, 1023);
+
+  constexpr std::array<s32, 3> biases{0, 128, -128};
+  // Scale 1, 2, 4 and 1/2
+  constexpr std::array<std::array<u32, 2>, 4> shifts{{{0, 0}, {1, 0}, {2, 0}, {0, 1}}};
+
+  for (const s32 bias : biases)
+  {
+    for (size_t scale = 0; scale < shifts.size(); ++scale)
+    {
+      for (const bool subtract : {false, true})
+      {
+        for (const bool clamp : {false, true})
+        {
+          const ColorMath::CombinerParams params{
+              .bias = bias,
+              .left_shift = shifts[scale][0],
+              .right_shift = shifts[scale][1],
+              .rounding = scale == 3 ? 0 : subtract ? 127 : 128,
+              .subtract = subtract,
+              .min = clamp ? s16(0) : s16(-1024),
+              .max = clamp ? s16(255) : s16(1023),
+          };
+
+          for (int i = 0; i < 2000; ++i)
+          {
+            ColorMath::Channels a, b, c, d;
+            for (size_t j = 0; j < 4; ++j)
+            {
+              a[j] = static_cast<s16>(input(rng));
+              b[j] = static_cast<s16>(input(rng));
+              c[j] = static_cast<s16>(input(rng));
+              d[j] = static_cast<s16>(i % 2 == 0 ? input(rng) : d_input(rng));
+            }
+            // The extremes are where rounding and clamping go wrong.
+            if (i < 4)
+            {
+              a.fill(i & 1 ? 255 : 0);
+              b.fill(i & 1 ? 0 : 255);
+              c.fill(i & 2 ? 255 : 128);
+              d.fill(i & 1 ? 1023 : -1024);
+            }
+
+            const ColorMath::Channels result = ColorMath::CombineRegular(a, b, c, d, params);
+            for (size_t j = 0; j < 4; ++j)
+            {
+              EXPECT_EQ(ReferenceCombine(a[j], b[j], c[j], d[j], params), result[j])
+                  << "a=" << a[j] << " b=" << b[j] << " c=" << c[j] << " d=" << d[j]
+                  << " bias=" << bias << " scale=" << scale << " subtract=" << subtract;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(ColorMath, Blend)
+{
+  std::mt19937 rng(5678);
+  std::uniform_int_distribution<u32> random_u32;
+
+  for (int i = 0; i < 100000; ++i)
+  {
+    const u32 src_bits = random_u32(rng);
+    const u32 dst_bits = random_u32(rng);
+    // Factors are often all zeros or all ones.
+    const u32 src_factor = i % 3 == 0 ? 0xffffffff : random_u32(rng);
+    const u32 dst_factor = i % 5 == 0 ? 0 : random_u32(rng);
+
+    std::array<u8, 4> src, dst, result;
+    std::memcpy(src.data(), &src_bits, sizeof(u32));
+    std::memcpy(dst.data(), &dst_bits, sizeof(u32));
+    ColorMath::Blend(src.data(), dst.data(), src_factor, dst_factor, result.data());
+
+    for (size_t j = 0; j < 4; ++j)
+    {
+      const u8 sf = static_cast<u8>(src_factor >> (j * 8));
+      const u8 df = static_cast<u8>(dst_factor >> (j * 8));
+      EXPECT_EQ(ReferenceBlend(src[j], dst[j], sf, df), result[j]);
+    }
+  }
+}
+
+TEST(ColorMath, Filter)
+{
+  std::mt19937 rng(9012);
+  std::uniform_int_distribution<u32> random_u32;
+
+  for (int fract_s = 0; fract_s < 128; ++fract_s)
+  {
+    for (int fract_t = 0; fract_t < 128; ++fract_t)
+    {
+      std::array<std::array<u8, 4>, 4> texels;
+      for (auto& texel : texels)
+      {
+        const u32 bits = random_u32(rng);
+        std::memcpy(texel.data(), &bits, sizeof(u32));
+      }
+      if (fract_s == fract_t)
+      {
+        for (auto& texel : texels)
+          texel.fill(255);
+      }
+
+      const std::array<s16, 4> weights{
+          s16((128 - fract_s) * (128 - fract_t)), s16(fract_s * (128 - fract_t)),
+          s16((128 - fract_s) * fract_t), s16(fract_s * fract_t)};
+
+      std::array<u8, 4> result;
+      ColorMath::Filter(texels[0].data(), texels[1].data(), texels[2].data(), texels[3].data(),
+                        weights[0], weights[1], weights[2], weights[3], 14, result.data());
+
+      for (size_t j = 0; j < 4; ++j)
+      {
+        u32 expected = 0;
+        for (size_t k = 0; k < 4; ++k)
+          expected += texels[k][j] * weights[k];
+        EXPECT_EQ(static_cast<u8>(expected >> 14), result[j]);
+      }
+    }
+  }
+}
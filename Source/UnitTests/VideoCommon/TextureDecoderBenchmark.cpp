@@ -0,0 +1,99 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+#include "Common/ScopeGuard.h"
+#include "VideoCommon/TextureDecoder.h"
+
+#include "TextureDecoderTestUtil.h"
+
+using namespace TextureDecoderTestUtil;
+
+namespace
+{
+struct Format
+{
+  std::string_view name;
+  TextureFormat format;
+};
+
+constexpr std::array FORMATS{
+    Format{"I4", TextureFormat::I4},         Format{"I8", TextureFormat::I8},
+    Format{"IA4", TextureFormat::IA4},       Format{"IA8", TextureFormat::IA8},
+    Format{"RGB565", TextureFormat::RGB565}, Format{"RGB5A3", TextureFormat::RGB5A3},
+    Format{"RGBA8", TextureFormat::RGBA8},   Format{"C4", TextureFormat::C4},
+    Format{"C8", TextureFormat::C8},         Format{"C14X2", TextureFormat::C14X2},
+    Format{"CMPR", TextureFormat::CMPR},
+};
+
+// Small enough for the source and the decoded texture to stay in the caches, so that the decoders
+// rather than the memory bandwidth are measured.
+constexpr int WIDTH = 256;
+constexpr int HEIGHT = 256;
+constexpr int PASSES = 200;
+
+double MeasureTexelsPerSecond(TextureFormat format, const std::vector<u8>& src,
+                              const std::vector<u8>& tlut, u32* dst)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < PASSES; ++pass)
+  {
+    _TexDecoder_DecodeImpl(dst, src.data(), WIDTH, HEIGHT, format, tlut.data(),
+                           TLUTFormat::RGB5A3);
+  }
+  const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(WIDTH) * HEIGHT * PASSES / time.count();
+}
+}  // namespace
+
+TEST(TextureDecoderBenchmark, TexelsPerSecond)
+{
+  InstructionSetOverride instruction_set_override;
+
+  std::mt19937 rng(0x5eed);
+  const std::vector<u8> tlut = GenerateRandomTLUT(rng);
+
+  fmt::print("{}x{} texels, {} passes, palettes in RGB5A3\n", WIDTH, HEIGHT, PASSES);
+  fmt::print("  {:8}", "");
+  for (const InstructionSet& set : INSTRUCTION_SETS)
+    fmt::print("{:>20}", set.name);
+  fmt::print("\n");
+
+  // Aligned like the buffer the texture cache decodes into.
+  u32* const dst =
+      static_cast<u32*>(Common::AllocateAlignedMemory(WIDTH * HEIGHT * sizeof(u32), 32));
+  Common::ScopeGuard free_dst([dst] { Common::FreeAlignedMemory(dst); });
+  for (const Format& format : FORMATS)
+  {
+    const std::vector<u8> src =
+        GenerateRandomBytes(TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, format.format), rng);
+
+    fmt::print("  {:8}", format.name);
+    double baseline = 0;
+    for (const InstructionSet& set : INSTRUCTION_SETS)
+    {
+      if (!instruction_set_override.Use(set))
+      {
+        fmt::print("{:>20}", "unsupported");
+        continue;
+      }
+
+      const double texels_per_second = MeasureTexelsPerSecond(format.format, src, tlut, dst);
+      if (baseline == 0)
+        baseline = texels_per_second;
+      fmt::print("{:>20}", fmt::format("{:.0f} M/s ({:.2f}x)", texels_per_second / 1e6,
+                                       texels_per_second / baseline));
+    }
+    fmt::print("\n");
+  }
+}
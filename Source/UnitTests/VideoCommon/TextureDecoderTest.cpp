@@ -0,0 +1,146 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+#include "TextureDecoderTestUtil.h"
+
+using namespace TextureDecoderTestUtil;
+
+namespace
+{
+constexpr std::array<TextureFormat, 12> TEXTURE_FORMATS{
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4,   TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR,  TextureFormat::XFB,
+};
+
+struct Level
+{
+  int width;
+  int height;
+};
+
+// Decodes every level on its own with _TexDecoder_DecodeImpl and compares the result to that of
+// TexDecoder_DecodeLevels, which splits them into bands and decodes those in parallel.
+void ExpectParallelDecodeMatchesSerial(TextureFormat format, const std::vector<Level>& levels)
+{
+  std::mt19937 rng(static_cast<u32>(format));
+  const std::vector<u8> tlut = GenerateRandomTLUT(rng);
+
+  size_t src_size = 0;
+  size_t dst_size = 0;
+  for (const Level& level : levels)
+  {
+    src_size += TexDecoder_GetTextureSizeInBytes(level.width, level.height, format);
+    dst_size += static_cast<size_t>(level.width) * level.height;
+  }
+  const std::vector<u8> src = GenerateRandomBytes(src_size, rng);
+
+  std::vector<u32> serial(dst_size);
+  std::vector<u32> parallel(dst_size);
+  std::vector<TextureDecodeLevel> decode_levels;
+
+  const u8* level_src = src.data();
+  size_t dst_offset = 0;
+  for (const Level& level : levels)
+  {
+    _TexDecoder_DecodeImpl(serial.data() + dst_offset, level_src, level.width, level.height,
+                           format, tlut.data(), TLUTFormat::RGB5A3);
+    decode_levels.push_back({reinterpret_cast<u8*>(parallel.data() + dst_offset), level_src,
+                             level.width, level.height});
+
+    level_src += TexDecoder_GetTextureSizeInBytes(level.width, level.height, format);
+    dst_offset += static_cast<size_t>(level.width) * level.height;
+  }
+
+  TexDecoder_DecodeLevels(decode_levels, format, tlut.data(), TLUTFormat::RGB5A3);
+
+  EXPECT_TRUE(serial == parallel) << "Format: " << static_cast<int>(format);
+}
+}  // namespace
+
+TEST(TextureDecoder, ParallelDecodeMatchesSerial)
+{
+  for (const TextureFormat format : TEXTURE_FORMATS)
+  {
+    // Large enough to be split, with a height that isn't a multiple of the band height.
+    ExpectParallelDecodeMatchesSerial(format, {{1024, 520}});
+  }
+}
+
+TEST(TextureDecoder, ParallelDecodeOfMipChainMatchesSerial)
+{
+  for (const TextureFormat format : TEXTURE_FORMATS)
+  {
+    const int block_width = TexDecoder_GetBlockWidthInTexels(format);
+    const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+
+    std::vector<Level> levels;
+    for (int size = 512; size >= 1; size /= 2)
+    {
+      // Levels are expanded to whole blocks.
+      levels.push_back({(size + block_width - 1) / block_width * block_width,
+                        (size + block_height - 1) / block_height * block_height});
+    }
+    ExpectParallelDecodeMatchesSerial(format, levels);
+  }
+}
+
+TEST(TextureDecoder, SmallTextureMatchesSerial)
+{
+  for (const TextureFormat format : TEXTURE_FORMATS)
+    ExpectParallelDecodeMatchesSerial(format, {{64, 32}});
+}
+
+#ifdef _M_X86_64
+TEST(TextureDecoder, InstructionSetsMatch)
+{
+  InstructionSetOverride instruction_set_override;
+
+  for (const TextureFormat format : TEXTURE_FORMATS)
+  {
+    // An odd number of blocks wide for the formats with blocks that are 4 texels wide.
+    const int block_width = TexDecoder_GetBlockWidthInTexels(format);
+    const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+    const int width = (36 + block_width - 1) / block_width * block_width;
+    const int height = (20 + block_height - 1) / block_height * block_height;
+
+    std::mt19937 rng(static_cast<u32>(format));
+    const std::vector<u8> tlut = GenerateRandomTLUT(rng);
+    const std::vector<u8> src =
+        GenerateRandomBytes(TexDecoder_GetTextureSizeInBytes(width, height, format), rng);
+
+    for (const TLUTFormat tlut_format : {TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3})
+    {
+      if (tlut_format != TLUTFormat::IA8 && !IsColorIndexed(format))
+        continue;
+
+      std::vector<u32> expected;
+      for (const InstructionSet& set : INSTRUCTION_SETS)
+      {
+        if (!instruction_set_override.Use(set))
+          continue;
+
+        std::vector<u32> decoded(static_cast<size_t>(width) * height);
+        _TexDecoder_DecodeImpl(decoded.data(), src.data(), width, height, format, tlut.data(),
+                               tlut_format);
+
+        if (expected.empty())
+          expected = std::move(decoded);
+        else
+          EXPECT_TRUE(decoded == expected) << set.name << ", format: " << static_cast<int>(format)
+                                           << ", TLUT format: " << static_cast<int>(tlut_format);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,42 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "TextureDecoderTestUtil.h"
+
+#include <algorithm>
+
+namespace TextureDecoderTestUtil
+{
+InstructionSetOverride::InstructionSetOverride() : m_host_cpu_info(cpu_info)
+{
+}
+
+InstructionSetOverride::~InstructionSetOverride()
+{
+  cpu_info = m_host_cpu_info;
+}
+
+bool InstructionSetOverride::Use(const InstructionSet& set)
+{
+  if ((set.ssse3 && !m_host_cpu_info.bSSSE3) || (set.avx2 && !m_host_cpu_info.bAVX2))
+    return false;
+
+  cpu_info.bSSSE3 = set.ssse3;
+  cpu_info.bAVX2 = set.avx2;
+  return true;
+}
+
+std::vector<u8> GenerateRandomBytes(size_t size, std::mt19937& rng)
+{
+  std::vector<u8> data(size);
+  std::uniform_int_distribution<int> distribution(0, 0xff);
+  std::ranges::generate(data, [&] { return static_cast<u8>(distribution(rng)); });
+  return data;
+}
+
+std::vector<u8> GenerateRandomTLUT(std::mt19937& rng)
+{
+  // C14X2 has the largest palettes, with 0x4000 entries.
+  return GenerateRandomBytes(0x4000 * sizeof(u16), rng);
+}
+}  // namespace TextureDecoderTestUtil
@@ -0,0 +1,58 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+
+namespace TextureDecoderTestUtil
+{
+struct InstructionSet
+{
+  std::string_view name;
+  bool ssse3;
+  bool avx2;
+};
+
+// The instruction sets that the x64 decoders have paths for. SSE2 is always available. Other hosts
+// only have one path.
+#ifdef _M_X86_64
+constexpr std::array INSTRUCTION_SETS{
+    InstructionSet{"SSE2", false, false},
+    InstructionSet{"SSSE3", true, false},
+    InstructionSet{"AVX2", true, true},
+};
+#else
+constexpr std::array INSTRUCTION_SETS{InstructionSet{"Generic", false, false}};
+#endif
+
+// Makes the decoders use the given instruction set by changing cpu_info, and restores the host's
+// cpu_info when destroyed.
+class InstructionSetOverride
+{
+public:
+  InstructionSetOverride();
+  ~InstructionSetOverride();
+
+  InstructionSetOverride(const InstructionSetOverride&) = delete;
+  InstructionSetOverride& operator=(const InstructionSetOverride&) = delete;
+
+  // Returns false without changing anything if the host CPU doesn't support the instruction set.
+  bool Use(const InstructionSet& set);
+
+private:
+  const CPUInfo m_host_cpu_info;
+};
+
+std::vector<u8> GenerateRandomBytes(size_t size, std::mt19937& rng);
+
+// Returns a random palette that is large enough for every color indexed format, C14X2 included.
+std::vector<u8> GenerateRandomTLUT(std::mt19937& rng);
+}  // namespace TextureDecoderTestUtil